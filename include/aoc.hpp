@@ -1,18 +1,35 @@
 #ifndef AOC_HEADER_INCLUDED
 #define AOC_HEADER_INCLUDED
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <format>
 #include <fstream>
 #include <ios>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -90,50 +107,336 @@ inline constexpr auto is_digit{detail::is_digit_fn{}};
 inline constexpr auto is_alpha{detail::is_alpha_fn{}};
 inline constexpr auto is_lower{detail::is_lower_fn{}};
 
-std::string slurp_file(std::string_view path) {
-  std::ios::sync_with_stdio(false);
+// Per-phase timing, compiled in with -DAOC_TIMING and printed to stderr at exit if the
+// environment variable AOC_TIMING is set.
+// A counter named after a phase and a unit, such as "part2 turns", is also printed as a rate per
+// second of that phase.
+// Without -DAOC_TIMING the timers and counters are empty and compile to nothing.
+#ifdef AOC_TIMING
+namespace detail {
+class TimingRegistry {
+  using Clock = std::chrono::steady_clock;
+
+  struct Phase {
+    std::string name;
+    Clock::duration total{};
+    long calls{};
+  };
+
+  struct Counter {
+    std::string name;
+    long value{};
+  };
+
+  std::mutex mutex;
+  std::vector<Phase> phases;
+  std::vector<Counter> counters;
+
+  static auto& find(auto& entries, std::string_view name) {
+    auto it{std::ranges::find(entries, name, [](auto& e) { return std::string_view(e.name); })};
+    if (it == entries.end()) {
+      it = entries.insert(it, {.name = std::string(name)});
+    }
+    return *it;
+  }
 
-  std::ifstream is{path.data(), std::ios::in | std::ios::binary};
-  is.exceptions(std::ifstream::badbit);
+  // Phase with the longest name that c is named after, followed by a space
+  [[nodiscard]] const Phase* phase_of(const Counter& c) const {
+    const Phase* best{nullptr};
+    for (const auto& p : phases) {
+      if (c.name.size() > p.name.size() and c.name.starts_with(p.name)
+          and c.name[p.name.size()] == ' ' and (not best or p.name.size() > best->name.size())) {
+        best = &p;
+      }
+    }
+    return best;
+  }
 
-  std::string data;
-  for (std::array<char, 256> buffer; is;) {
-    is.read(buffer.data(), buffer.size());
-    std::ranges::copy(buffer | std::views::take(is.gcount()), std::back_inserter(data));
+ public:
+  void add_time(std::string_view name, Clock::duration d) {
+    std::scoped_lock lock{mutex};
+    auto& phase{find(phases, name)};
+    phase.total += d;
+    phase.calls += 1;
   }
-  return data;
+
+  void add_count(std::string_view name, long n) {
+    std::scoped_lock lock{mutex};
+    find(counters, name).value += n;
+  }
+
+  ~TimingRegistry() {
+    if (std::getenv("AOC_TIMING") == nullptr) {
+      return;
+    }
+    for (const auto& p : phases) {
+      const std::chrono::duration<double, std::milli> ms{p.total};
+      std::cerr << std::format("{:<16} {:>8} calls {:>12.3f} ms\n", p.name, p.calls, ms.count());
+    }
+    for (const auto& c : counters) {
+      std::cerr << std::format("{:<16} {:>8}", c.name, c.value);
+      if (const auto* p{phase_of(c)}; p and p->total > Clock::duration::zero()) {
+        const std::chrono::duration<double> seconds{p->total};
+        const auto unit{std::string_view(c.name).substr(p->name.size() + 1)};
+        std::cerr << std::format(" {:>12.0f} {}/s", c.value / seconds.count(), unit);
+      }
+      std::cerr << '\n';
+    }
+  }
+};
+
+// inline, so that all solutions linked into one multicall binary share one registry
+inline TimingRegistry& timing_registry() {
+  static TimingRegistry registry;
+  return registry;
 }
+}  // namespace detail
 
-std::vector<std::string> slurp_lines(std::string_view path) {
-  std::vector<std::string> lines;
-  {
-    std::istringstream is{slurp_file(path)};
-    for (std::string line; std::getline(is, line);) {
-      lines.push_back(line);
+// Adds the lifetime of the scope to the total time of the named phase
+class ScopeTimer {
+  std::string_view name;
+  std::chrono::steady_clock::time_point begin{std::chrono::steady_clock::now()};
+
+ public:
+  explicit ScopeTimer(std::string_view phase) : name{phase} {
+  }
+
+  ScopeTimer(const ScopeTimer&) = delete;
+  ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+  ~ScopeTimer() {
+    detail::timing_registry().add_time(name, std::chrono::steady_clock::now() - begin);
+  }
+};
+
+void count(std::string_view counter, long n = 1) {
+  detail::timing_registry().add_count(counter, n);
+}
+#else
+class ScopeTimer {
+ public:
+  explicit constexpr ScopeTimer(std::string_view) noexcept {
+  }
+
+  // not trivial, so that timer variables do not trigger unused variable warnings
+  ~ScopeTimer() {
+  }
+};
+
+constexpr void count(std::string_view, long = 1) noexcept {
+}
+#endif
+
+// Result of fn(), timed as the named phase
+template <typename Fn>
+decltype(auto) timed(std::string_view phase, Fn&& fn) {
+  const ScopeTimer timer{phase};
+  return std::forward<Fn>(fn)();
+}
+
+// Read-only view of a whole input file without copying it.
+// Regular files are memory-mapped, anything else such as a pipe to /dev/stdin is read into a
+// buffer.
+class InputView {
+  void* mapping{nullptr};
+  std::size_t mapping_size{};
+  std::string buffer;
+  std::string_view data_;
+
+ public:
+  explicit InputView(std::string_view path) {
+    const std::string path_str{path};
+    const int fd{::open(path_str.c_str(), O_RDONLY)};
+    if (fd < 0) {
+      throw std::runtime_error("cannot open input file " + path_str);
     }
-    if (not is and not is.eof()) {
-      throw std::runtime_error("input is invalid");
+    if (struct stat st{}; ::fstat(fd, &st) == 0 and S_ISREG(st.st_mode) and st.st_size > 0) {
+      const auto size{static_cast<std::size_t>(st.st_size)};
+      if (void* p{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)}; p != MAP_FAILED) {
+        mapping = p;
+        mapping_size = size;
+        data_ = {static_cast<const char*>(p), size};
+      }
     }
-    if (lines.empty()) {
-      throw std::runtime_error("input is empty");
+    if (mapping == nullptr) {
+      constexpr auto chunk_size{1UZ << 16};
+      for (auto n{buffer.size()};;) {
+        buffer.resize(n + chunk_size);
+        const auto n_read{::read(fd, buffer.data() + n, chunk_size)};
+        if (n_read < 0 and errno == EINTR) {
+          continue;
+        }
+        if (n_read < 0) {
+          ::close(fd);
+          throw std::runtime_error("failed reading input file " + path_str);
+        }
+        if (n_read == 0) {
+          buffer.resize(n);
+          break;
+        }
+        n += static_cast<std::size_t>(n_read);
+      }
+      data_ = buffer;
+    }
+    ::close(fd);
+  }
+
+  InputView(InputView&& other) noexcept
+      : mapping{std::exchange(other.mapping, nullptr)},
+        mapping_size{std::exchange(other.mapping_size, 0)},
+        buffer{std::move(other.buffer)},
+        data_{mapping ? std::exchange(other.data_, {}) : std::string_view(buffer)} {
+  }
+
+  InputView(const InputView&) = delete;
+  InputView& operator=(const InputView&) = delete;
+  InputView& operator=(InputView&&) = delete;
+
+  ~InputView() {
+    if (mapping) {
+      ::munmap(mapping, mapping_size);
+    }
+  }
+
+  [[nodiscard]] std::string_view data() const noexcept {
+    return data_;
+  }
+
+  // Lines as split by std::getline, views into data()
+  [[nodiscard]] std::vector<std::string_view> lines() const;
+};
+
+// Parts of s between the separators, including empty ones
+std::vector<std::string_view> split(std::string_view s, const char sep) {
+  std::vector<std::string_view> parts;
+  for (std::size_t end; (end = s.find(sep)) != std::string_view::npos; s.remove_prefix(end + 1)) {
+    parts.push_back(s.substr(0, end));
+  }
+  parts.push_back(s);
+  return parts;
+}
+
+// Non-empty parts of s between whitespace and the optional extra separator
+std::vector<std::string_view> fields(std::string_view s, std::optional<char> sep = std::nullopt) {
+  const auto is_sep{[sep](char ch) {
+    return std::isspace(static_cast<unsigned char>(ch)) or (sep and ch == *sep);
+  }};
+  std::vector<std::string_view> parts;
+  for (auto it{s.begin()}; it != s.end();) {
+    const auto first{std::find_if_not(it, s.end(), is_sep)};
+    it = std::find_if(first, s.end(), is_sep);
+    if (first != it) {
+      parts.emplace_back(first, it);
     }
-    return lines;
   }
+  return parts;
+}
+
+std::vector<std::string_view> InputView::lines() const {
+  auto lines{split(data_, '\n')};
+  if (lines.back().empty()) {
+    // no line after the last newline
+    lines.pop_back();
+  }
+  return lines;
+}
+
+// Integer spelled by all of s, with an optional sign
+template <std::integral Int>
+Int to_int(std::string_view s) {
+  if (s.starts_with('+') and not s.substr(1).starts_with('-')) {
+    s.remove_prefix(1);
+  }
+  Int value{};
+  if (auto [ptr, ec]{std::from_chars(s.data(), s.data() + s.size(), value)};
+      ec != std::errc{} or ptr != s.data() + s.size()) {
+    throw std::runtime_error("invalid integer '" + std::string(s) + "'");
+  }
+  return value;
+}
+
+// Next integer in s after skipping everything else, s is advanced past it
+template <std::integral Int>
+std::optional<Int> scan_int(std::string_view& s) {
+  const auto is_start{[&s](std::size_t i) {
+    return is_digit(s[i])
+           or (std::is_signed_v<Int> and s[i] == '-' and i + 1 < s.size() and is_digit(s[i + 1]));
+  }};
+  auto i{0UZ};
+  for (; i < s.size() and not is_start(i); ++i) {
+  }
+  if (i == s.size()) {
+    s = {};
+    return std::nullopt;
+  }
+  Int value{};
+  const auto [ptr, ec]{std::from_chars(s.data() + i, s.data() + s.size(), value)};
+  if (ec != std::errc{}) {
+    throw std::runtime_error("integer is out of range");
+  }
+  s.remove_prefix(static_cast<std::size_t>(ptr - s.data()));
+  return value;
+}
+
+// All integers in s, ignoring everything between them
+template <std::integral Int = int>
+std::vector<Int> scan_ints(std::string_view s) {
+  std::vector<Int> values;
+  while (const auto value{scan_int<Int>(s)}) {
+    values.push_back(*value);
+  }
+  return values;
+}
+
+std::string slurp_file(std::string_view path) {
+  std::ios::sync_with_stdio(false);
+  const ScopeTimer timer{"input"};
+  return std::string(InputView(path).data());
+}
+
+std::vector<std::string> slurp_lines(std::string_view path) {
+  std::ios::sync_with_stdio(false);
+  const ScopeTimer timer{"input"};
+  const InputView input(path);
+  auto lines{input.lines() | std::views::transform([](auto s) { return std::string(s); })
+             | std::ranges::to<std::vector>()};
+  if (lines.empty()) {
+    throw std::runtime_error("input is empty");
+  }
+  return lines;
 }
 
 template <typename T>
 std::vector<T> parse_items(std::string_view path, std::optional<char> sep = std::nullopt) {
-  auto input{slurp_file(path)};
-  if (sep) {
-    std::ranges::replace(input, sep.value(), ' ');
-  }
-  std::istringstream is{input};
+  std::ios::sync_with_stdio(false);
+  const ScopeTimer timer{"input"};
+  const InputView input(path);
   std::vector<T> items;
-  for (T item; is >> item;) {
-    items.push_back(item);
-  }
-  if (not is and not is.eof()) {
-    throw std::runtime_error("stream read error before EOF");
+  if constexpr (std::same_as<T, char>) {
+    for (char ch : input.data()) {
+      if (not std::isspace(static_cast<unsigned char>(ch)) and not(sep and ch == *sep)) {
+        items.push_back(ch);
+      }
+    }
+  } else if constexpr (std::integral<T>) {
+    items = fields(input.data(), sep) | std::views::transform(to_int<T>)
+            | std::ranges::to<std::vector>();
+  } else if constexpr (std::same_as<T, std::string>) {
+    items = fields(input.data(), sep)
+            | std::views::transform([](auto s) { return std::string(s); })
+            | std::ranges::to<std::vector>();
+  } else {
+    std::string text{input.data()};
+    if (sep) {
+      std::ranges::replace(text, sep.value(), ' ');
+    }
+    std::istringstream is{text};
+    for (T item; is >> item;) {
+      items.push_back(item);
+    }
+    if (not is and not is.eof()) {
+      throw std::runtime_error("stream read error before EOF");
+    }
   }
   if (items.empty()) {
     throw std::runtime_error("input is empty");
@@ -181,6 +484,163 @@ std::istream& operator>>(std::istream& is, skip<Patterns...>&& s) {
   return s.consume(is);
 }
 
+// String literal usable as a template argument
+template <std::size_t N>
+struct FormatString {
+  std::array<char, N - 1> chars{};
+
+  constexpr FormatString(const char (&s)[N]) {
+    std::copy_n(s, N - 1, chars.begin());
+  }
+
+  [[nodiscard]] constexpr std::string_view view() const {
+    return {chars.data(), chars.size()};
+  }
+};
+
+namespace detail {
+
+constexpr bool is_space(char ch) {
+  return ch == ' ' or ('\t' <= ch and ch <= '\r');
+}
+
+constexpr bool is_field(std::string_view fmt, std::size_t i) {
+  return i + 1 < fmt.size() and fmt[i] == '{' and fmt[i + 1] == '}';
+}
+
+constexpr std::size_t count_fields(std::string_view fmt) {
+  auto n{0UZ};
+  for (auto i{0UZ}; i < fmt.size(); ++i) {
+    if (is_field(fmt, i)) {
+      n += 1;
+      i += 1;
+    }
+  }
+  return n;
+}
+
+// Literal text around the N fields of fmt
+template <std::size_t N>
+constexpr std::array<std::string_view, N + 1> format_literals(std::string_view fmt) {
+  std::array<std::string_view, N + 1> literals;
+  auto n{0UZ};
+  auto begin{0UZ};
+  for (auto i{0UZ}; i < fmt.size(); ++i) {
+    if (is_field(fmt, i)) {
+      literals[n++] = fmt.substr(begin, i - begin);
+      begin = i + 2;
+      i += 1;
+    }
+  }
+  literals[N] = fmt.substr(begin);
+  return literals;
+}
+
+template <std::size_t N, typename... Ts>
+struct scan_result {
+  static_assert(sizeof...(Ts) == N, "there must be one type for every {} in the format");
+  using type = std::tuple<Ts...>;
+};
+
+template <std::size_t N>
+struct scan_result<N> {
+  using type = decltype([]<std::size_t... I>(std::index_sequence<I...>) {
+    return std::tuple<decltype(I, int{})...>{};
+  }(std::make_index_sequence<N>{}));
+};
+
+// Whitespace in the literal matches any amount of whitespace, including none
+constexpr bool match_literal(std::string_view literal, std::string_view& s) {
+  for (char ch : literal) {
+    if (is_space(ch)) {
+      while (not s.empty() and is_space(s.front())) {
+        s.remove_prefix(1);
+      }
+    } else if (s.empty() or s.front() != ch) {
+      return false;
+    } else {
+      s.remove_prefix(1);
+    }
+  }
+  return true;
+}
+
+// Strings end before the next literal, or at whitespace if the next literal starts with it
+template <typename T>
+bool scan_field(std::string_view next_literal, std::string_view& s, T& value) {
+  if constexpr (std::same_as<T, char>) {
+    if (s.empty()) {
+      return false;
+    }
+    value = s.front();
+    s.remove_prefix(1);
+    return true;
+  } else if constexpr (std::integral<T>) {
+    if (s.starts_with('+')) {
+      s.remove_prefix(1);
+      if (s.starts_with('-')) {
+        return false;
+      }
+    }
+    const auto [ptr, ec]{std::from_chars(s.data(), s.data() + s.size(), value)};
+    s.remove_prefix(static_cast<std::size_t>(ptr - s.data()));
+    return ec == std::errc{};
+  } else {
+    static_assert(
+        std::same_as<T, std::string_view> or std::same_as<T, std::string>,
+        "fields must be integers, chars or strings"
+    );
+    const auto end{
+        next_literal.empty() or is_space(next_literal.front())
+            ? std::ranges::find_if(s, is_space) - s.begin()
+            : std::ranges::find(s, next_literal.front()) - s.begin()
+    };
+    if (end == 0) {
+      return false;
+    }
+    value = T(s.substr(0, static_cast<std::size_t>(end)));
+    s.remove_prefix(static_cast<std::size_t>(end));
+    return true;
+  }
+}
+
+}  // namespace detail
+
+// Values of the {} fields in fmt matched at the start of s, which is then advanced past the match.
+// Fields are int unless their types are given.
+template <FormatString fmt, typename... Ts>
+auto scan_prefix(std::string_view& s) {
+  static constexpr auto n_fields{detail::count_fields(fmt.view())};
+  static constexpr auto literals{detail::format_literals<n_fields>(fmt.view())};
+  using Result = typename detail::scan_result<n_fields, Ts...>::type;
+
+  std::optional<Result> values{Result{}};
+  auto rest{s};
+  const bool ok{[&]<std::size_t... I>(std::index_sequence<I...>) {
+    return (
+        ... and (detail::match_literal(literals[I], rest)
+                 and detail::scan_field(literals[I + 1], rest, std::get<I>(*values)))
+    );
+  }(std::make_index_sequence<n_fields>{})};
+
+  if (ok and detail::match_literal(literals[n_fields], rest)) {
+    s = rest;
+  } else {
+    values.reset();
+  }
+  return values;
+}
+
+// Values of the {} fields in fmt matched against all of s except trailing whitespace
+template <FormatString fmt, typename... Ts>
+auto scan(std::string_view s) {
+  auto values{scan_prefix<fmt, Ts...>(s)};
+  if (not std::ranges::all_of(s, detail::is_space)) {
+    values.reset();
+  }
+  return values;
+}
+
 template <std::integral Int>
 constexpr Int saturating_add(Int a, Int b) {
   // https://stackoverflow.com/a/17582366/5951112
@@ -197,6 +657,370 @@ constexpr Int saturating_add(Int a, Int b) {
   return a + b;
 }
 
+// Row-major grid of width x height cells inside a border of padding cells.
+// The cells adjacent to any interior cell are in the buffer, so probing them needs no bounds
+// check when the border holds a sentinel value.
+template <typename T>
+  requires(not std::same_as<T, bool>)  // std::vector<bool> has no T& to return
+class Grid2 {
+ public:
+  using Vec2 = ndvec::vec2<int>;
+
+ private:
+  int width_{};
+  int height_{};
+  int pad_{};
+  std::vector<T> cells;
+
+  [[nodiscard]] std::size_t stride() const noexcept {
+    return width_ + 2 * pad_;
+  }
+
+ public:
+  Grid2() = default;
+
+  Grid2(const int width, const int height, const T& fill = {}, const T& border = {}, int pad = 1)
+      : width_{width},
+        height_{height},
+        pad_{pad},
+        cells((width + 2 * pad) * (height + 2 * pad), border) {
+    for (auto&& p : positions()) {
+      (*this)[p] = fill;
+    }
+  }
+
+  [[nodiscard]] int width() const noexcept {
+    return width_;
+  }
+
+  [[nodiscard]] int height() const noexcept {
+    return height_;
+  }
+
+  // Number of cells including the border, an upper bound of index()
+  [[nodiscard]] std::size_t buffer_size() const noexcept {
+    return cells.size();
+  }
+
+  [[nodiscard]] bool contains(const Vec2& p) const noexcept {
+    return static_cast<unsigned>(p.x()) < static_cast<unsigned>(width_)
+           and static_cast<unsigned>(p.y()) < static_cast<unsigned>(height_);
+  }
+
+  [[nodiscard]] std::size_t index(const Vec2& p) const noexcept {
+    return (p.y() + pad_) * stride() + (p.x() + pad_);
+  }
+
+  [[nodiscard]] Vec2 position(const std::size_t i) const noexcept {
+    return Vec2(static_cast<int>(i % stride()) - pad_, static_cast<int>(i / stride()) - pad_);
+  }
+
+  // Index offsets of the cells above, right of, below and left of any cell
+  [[nodiscard]] std::array<std::ptrdiff_t, 4> adjacent_offsets() const noexcept {
+    const auto s{static_cast<std::ptrdiff_t>(stride())};
+    return {-s, 1, s, -1};
+  }
+
+  // Unchecked, valid for interior and border cells
+  [[nodiscard]] T& operator[](const Vec2& p) noexcept {
+    return cells[index(p)];
+  }
+  [[nodiscard]] const T& operator[](const Vec2& p) const noexcept {
+    return cells[index(p)];
+  }
+  [[nodiscard]] T& operator[](const std::size_t i) noexcept {
+    return cells[i];
+  }
+  [[nodiscard]] const T& operator[](const std::size_t i) const noexcept {
+    return cells[i];
+  }
+
+  [[nodiscard]] T& at(const Vec2& p) {
+    if (not contains(p)) {
+      throw std::out_of_range("position is outside the grid");
+    }
+    return (*this)[p];
+  }
+  [[nodiscard]] const T& at(const Vec2& p) const {
+    if (not contains(p)) {
+      throw std::out_of_range("position is outside the grid");
+    }
+    return (*this)[p];
+  }
+
+  // All interior positions in row-major order
+  [[nodiscard]] auto positions() const {
+    return std::views::iota(0, height_) | std::views::transform([w = width_](int y) {
+             return std::views::iota(0, w)
+                    | std::views::transform([y](int x) { return Vec2(x, y); });
+           })
+           | std::views::join;
+  }
+
+  [[nodiscard]] std::optional<Vec2> find(const T& value) const {
+    for (auto&& p : positions()) {
+      if ((*this)[p] == value) {
+        return p;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool operator==(const Grid2&) const = default;
+};
+
+// One cell per character, mapped with to_cell(ch) or to_cell(ch, position)
+template <typename T, typename ToCell>
+Grid2<T> parse_grid2(const std::vector<std::string>& lines, const T& border, ToCell&& to_cell) {
+  if (lines.empty() or lines.front().empty()) {
+    throw std::runtime_error("grid is empty");
+  }
+  Grid2<T> grid(lines.front().size(), lines.size(), border, border);
+  for (auto y{0UZ}; y < lines.size(); ++y) {
+    if (lines[y].size() != lines.front().size()) {
+      throw std::runtime_error("every row must be of equal length");
+    }
+    for (auto x{0UZ}; x < lines[y].size(); ++x) {
+      const typename Grid2<T>::Vec2 p(x, y);
+      if constexpr (std::invocable<ToCell, char, typename Grid2<T>::Vec2>) {
+        grid[p] = to_cell(lines[y][x], p);
+      } else {
+        grid[p] = to_cell(lines[y][x]);
+      }
+    }
+  }
+  return grid;
+}
+
+template <typename T = char>
+Grid2<T> parse_grid2(const std::vector<std::string>& lines, const T& border = {}) {
+  return parse_grid2(lines, border, [](char ch) { return T{ch}; });
+}
+
+// Priority queue for small non-negative integer keys that never drop below the last popped key.
+// Items are kept in a ring of buckets indexed by key as in Dial's algorithm, so push and pop are
+// O(1) amortized. The ring grows when a key is pushed too far ahead of the smallest key.
+template <typename T>
+class BucketQueue {
+  std::vector<std::vector<T>> buckets;
+  std::size_t min_key_{};
+  std::size_t size_{};
+
+  [[nodiscard]] std::size_t mask() const noexcept {
+    return buckets.size() - 1;
+  }
+
+  void grow(const std::size_t key_span) {
+    std::vector<std::vector<T>> grown(std::bit_ceil(key_span));
+    for (auto i{0UZ}; i < buckets.size(); ++i) {
+      const auto key{min_key_ + ((i - min_key_) & mask())};
+      grown[key & (grown.size() - 1)] = std::move(buckets[i]);
+    }
+    buckets = std::move(grown);
+  }
+
+ public:
+  explicit BucketQueue(const std::size_t key_span = 16)
+      : buckets(std::bit_ceil(std::max(key_span, 1UZ))) {
+  }
+
+  [[nodiscard]] bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return size_;
+  }
+
+  void push(const std::size_t key, T value) {
+    if (key < min_key_) {
+      throw std::invalid_argument("bucket queue key is below the last popped key");
+    }
+    if (key - min_key_ > mask()) {
+      grow(key - min_key_ + 1);
+    }
+    buckets[key & mask()].push_back(std::move(value));
+    size_ += 1;
+  }
+
+  // Remove one of the items with the smallest key
+  std::pair<std::size_t, T> pop() {
+    if (empty()) {
+      throw std::out_of_range("bucket queue is empty");
+    }
+    for (; buckets[min_key_ & mask()].empty(); ++min_key_) {
+    }
+    auto& bucket{buckets[min_key_ & mask()]};
+    std::pair<std::size_t, T> item{min_key_, std::move(bucket.back())};
+    bucket.pop_back();
+    size_ -= 1;
+    return item;
+  }
+};
+
+namespace detail {
+struct zero_heuristic_fn {
+  constexpr int operator()(std::size_t) const noexcept {
+    return 0;
+  }
+};
+}  // namespace detail
+
+// Length of a shortest path from any source to a state where is_goal holds, over the dense states
+// [0, n_states). edges(s, relax) calls relax(t, w) for every edge s -> t of weight w >= 0.
+// With a consistent heuristic(s) that never overestimates the remaining length, this is A*.
+template <typename Edges, typename Goal, typename Heuristic = detail::zero_heuristic_fn>
+std::optional<int> shortest_path(
+    const std::size_t n_states,
+    const std::vector<std::size_t>& sources,
+    Edges&& edges,
+    Goal&& is_goal,
+    Heuristic&& heuristic = {}
+) {
+  std::vector<int> dist(n_states, std::numeric_limits<int>::max());
+  BucketQueue<std::size_t> q;
+  for (const auto s : sources) {
+    dist.at(s) = 0;
+    q.push(heuristic(s), s);
+  }
+  long n_expanded{};
+  while (not q.empty()) {
+    const auto [key, s]{q.pop()};
+    if (static_cast<int>(key) - heuristic(s) > dist[s]) {
+      // s was reached again with a shorter path after this item was pushed
+      continue;
+    }
+    if (is_goal(s)) {
+      count("expanded states", n_expanded);
+      return dist[s];
+    }
+    ++n_expanded;
+    edges(s, [&, src_dist = dist[s]](const std::size_t t, const int w) {
+      if (const auto d{src_dist + w}; d < dist[t]) {
+        dist[t] = d;
+        q.push(d + heuristic(t), t);
+      }
+    });
+  }
+  count("expanded states", n_expanded);
+  return std::nullopt;
+}
+
+// Sequence of distinct ids from [0, capacity) for puzzles that move elements around a long list by
+// position. The ids are kept in blocks of about sqrt(size) ids and the block of every id is
+// recorded, so the id at a position, the position of an id, insert and erase are O(sqrt(size)).
+class BlockList {
+  std::vector<std::vector<std::size_t>> blocks;
+  std::vector<std::size_t> block_of;
+  std::size_t size_{};
+  std::size_t block_size{};
+
+  // Spread the ids evenly over blocks of block_size ids
+  void rebuild() {
+    std::vector<std::size_t> ids;
+    ids.reserve(size_);
+    for (const auto& block : blocks) {
+      ids.insert(ids.end(), block.begin(), block.end());
+    }
+    block_size = std::max(16UZ, 1UZ << (std::bit_width(size_) / 2));
+    blocks.assign((size_ + block_size - 1) / block_size, {});
+    if (blocks.empty()) {
+      blocks.emplace_back();
+    }
+    for (auto i{0UZ}; i < ids.size(); ++i) {
+      blocks[i / block_size].push_back(ids[i]);
+      block_of[ids[i]] = i / block_size;
+    }
+  }
+
+  // Block holding position pos and the offset of pos in the block, pos == size() is past the end
+  // of the last block
+  [[nodiscard]] std::pair<std::size_t, std::size_t> locate(std::size_t pos) const {
+    auto b{0UZ};
+    for (; b + 1 < blocks.size() and pos >= blocks[b].size(); ++b) {
+      pos -= blocks[b].size();
+    }
+    return {b, pos};
+  }
+
+ public:
+  explicit BlockList(const std::size_t capacity) : blocks(1), block_of(capacity) {
+    rebuild();
+  }
+
+  template <std::ranges::input_range R>
+  BlockList(const std::size_t capacity, R&& ids) : blocks(1), block_of(capacity) {
+    for (const std::size_t id : ids) {
+      if (id >= capacity) {
+        throw std::out_of_range("block list id is not below the capacity");
+      }
+      blocks.front().push_back(id);
+    }
+    size_ = blocks.front().size();
+    rebuild();
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return size_;
+  }
+
+  [[nodiscard]] std::size_t at(const std::size_t pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("block list position is out of range");
+    }
+    const auto [b, i]{locate(pos)};
+    return blocks[b][i];
+  }
+
+  [[nodiscard]] std::size_t position(const std::size_t id) const {
+    const auto& block{blocks[block_of.at(id)]};
+    const auto it{std::ranges::find(block, id)};
+    if (it == block.end()) {
+      throw std::out_of_range("id is not in the block list");
+    }
+    auto pos{static_cast<std::size_t>(it - block.begin())};
+    for (auto b{0UZ}; b < block_of[id]; ++b) {
+      pos += blocks[b].size();
+    }
+    return pos;
+  }
+
+  void insert(const std::size_t pos, const std::size_t id) {
+    if (pos > size_ or id >= block_of.size()) {
+      throw std::out_of_range("block list insert position or id is out of range");
+    }
+    const auto [b, i]{locate(pos)};
+    blocks[b].insert(blocks[b].begin() + static_cast<std::ptrdiff_t>(i), id);
+    block_of[id] = b;
+    size_ += 1;
+    if (blocks[b].size() > 2 * block_size) {
+      rebuild();
+    }
+  }
+
+  // Remove and return the id at pos
+  std::size_t erase(const std::size_t pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("block list position is out of range");
+    }
+    const auto [b, i]{locate(pos)};
+    const auto id{blocks[b][i]};
+    blocks[b].erase(blocks[b].begin() + static_cast<std::ptrdiff_t>(i));
+    size_ -= 1;
+    // rebuild when a block runs empty, so that the blocks and block_size follow a shrinking list
+    if (blocks[b].empty() and blocks.size() > 1) {
+      rebuild();
+    }
+    return id;
+  }
+
+  // Move id to position pos of the list, counted without the id itself
+  void move(const std::size_t id, const std::size_t pos) {
+    erase(position(id));
+    insert(pos, id);
+  }
+};
+
 constexpr char ocr(std::string_view rows) {
   if (const auto it{std::ranges::find_if(
           detail::ocr_letter_rows,
@@ -0,0 +1,417 @@
+#ifndef CELLULAR_HEADER_INCLUDED
+#define CELLULAR_HEADER_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace cellular {
+
+using Word = std::uint64_t;
+
+constexpr std::size_t word_bits{std::numeric_limits<Word>::digits};
+
+// Per-cell counters of 64 cells stored bit-sliced, bit i of every counter is in planes[i]
+template <std::size_t Bits>
+struct Counts {
+  std::array<Word, Bits> planes{};
+
+  // Increment the counters of cells set in w
+  void add(Word w) {
+    for (auto& plane : planes) {
+      const auto carry{plane & w};
+      plane ^= w;
+      w = carry;
+      if (w == 0) {
+        break;
+      }
+    }
+  }
+
+  template <std::size_t B>
+  void add(const Counts<B>& other) {
+    Word carry{};
+    for (auto i{0UZ}; i < Bits; ++i) {
+      const auto b{i < B ? other.planes[i] : Word{}};
+      const auto sum{planes[i] ^ b ^ carry};
+      carry = (planes[i] & b) | (carry & (planes[i] ^ b));
+      planes[i] = sum;
+      if (i >= B and carry == 0) {
+        break;
+      }
+    }
+  }
+
+  // Cells whose counter is n
+  [[nodiscard]]
+  Word equals(const unsigned n) const {
+    if (std::bit_width(n) > Bits) {
+      return {};
+    }
+    auto w{~Word{}};
+    for (auto i{0UZ}; i < Bits; ++i) {
+      w &= ((n >> i) & 1U) ? planes[i] : ~planes[i];
+    }
+    return w;
+  }
+
+  // Cells whose counter is at least n
+  [[nodiscard]]
+  Word at_least(const unsigned n) const {
+    if (std::bit_width(n) > Bits) {
+      return {};
+    }
+    Word greater{};
+    auto equal{~Word{}};
+    for (auto i{Bits}; i-- > 0;) {
+      if ((n >> i) & 1U) {
+        equal &= planes[i];
+      } else {
+        greater |= equal & planes[i];
+        equal &= ~planes[i];
+      }
+    }
+    return greater | equal;
+  }
+};
+
+// Counter width for the 3^N cells of an N-dimensional Moore neighbourhood
+constexpr std::size_t moore_bits(std::size_t n_dims) {
+  auto n{1UZ};
+  for (; n_dims > 0; --n_dims) {
+    n *= 3;
+  }
+  return std::bit_width(n);
+}
+
+// Word k of a row shifted one cell east, bit x holds cell x - 1
+Word west_of(std::span<const Word> row, const std::size_t k) {
+  return (row[k] << 1) | (k > 0 ? row[k - 1] >> (word_bits - 1) : Word{});
+}
+
+// Word k of a row shifted one cell west, bit x holds cell x + 1
+Word east_of(std::span<const Word> row, const std::size_t k) {
+  return (row[k] >> 1) | (k + 1 < row.size() ? row[k + 1] << (word_bits - 1) : Word{});
+}
+
+// Set or clear the bits [first, last) of a row
+void fill_bits(std::span<Word> row, std::size_t first, const std::size_t last, bool value) {
+  for (; first < last;) {
+    const auto k{first / word_bits};
+    const auto lo{first % word_bits};
+    const auto hi{std::min(word_bits, lo + (last - first))};
+    const auto mask{(hi == word_bits ? ~Word{} : (Word{1} << hi) - 1) & ~((Word{1} << lo) - 1)};
+    row[k] = value ? row[k] | mask : row[k] & ~mask;
+    first += hi - lo;
+  }
+}
+
+// N-dimensional board of cells packed along the first axis, 64 cells per word.
+// Every other axis combination is one row of row_words() words, unused trailing bits are zero.
+template <std::size_t N>
+  requires(N > 0)
+class Board {
+ public:
+  using Index = std::array<int, N>;
+
+ private:
+  Index shape_{};
+  std::size_t row_words_{};
+  std::vector<Word> words_;
+
+ public:
+  Board() = default;
+
+  explicit Board(const Index& shape)
+      : shape_{shape},
+        row_words_{(static_cast<std::size_t>(shape[0]) + word_bits - 1) / word_bits} {
+    if (std::ranges::any_of(shape, [](int n) { return n < 0; })) {
+      throw std::invalid_argument("board shape must not be negative");
+    }
+    auto n_rows{1UZ};
+    for (auto d{1UZ}; d < N; ++d) {
+      n_rows *= static_cast<std::size_t>(shape[d]);
+    }
+    words_.resize(n_rows * row_words_);
+  }
+
+  [[nodiscard]]
+  const Index& shape() const noexcept {
+    return shape_;
+  }
+
+  [[nodiscard]]
+  std::size_t row_words() const noexcept {
+    return row_words_;
+  }
+
+  [[nodiscard]]
+  std::size_t n_rows() const noexcept {
+    return row_words_ == 0 ? 0 : words_.size() / row_words_;
+  }
+
+  [[nodiscard]]
+  std::span<Word> row(std::size_t r) {
+    return std::span(words_).subspan(r * row_words_, row_words_);
+  }
+
+  [[nodiscard]]
+  std::span<const Word> row(std::size_t r) const {
+    return std::span(words_).subspan(r * row_words_, row_words_);
+  }
+
+  [[nodiscard]]
+  std::span<Word> words() noexcept {
+    return words_;
+  }
+
+  [[nodiscard]]
+  std::span<const Word> words() const noexcept {
+    return words_;
+  }
+
+  // Bits of the last word in a row that are inside the board
+  [[nodiscard]]
+  Word last_word_mask() const noexcept {
+    const auto tail{static_cast<std::size_t>(shape_[0]) % word_bits};
+    return tail == 0 ? ~Word{} : (Word{1} << tail) - 1;
+  }
+
+  [[nodiscard]]
+  bool contains(const Index& p) const {
+    for (auto d{0UZ}; d < N; ++d) {
+      if (static_cast<unsigned>(p[d]) >= static_cast<unsigned>(shape_[d])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Row of a position, ignoring its first coordinate
+  [[nodiscard]]
+  std::size_t row_index(const Index& p) const {
+    auto r{0UZ};
+    for (auto d{N}; d-- > 1;) {
+      r = r * static_cast<std::size_t>(shape_[d]) + static_cast<std::size_t>(p[d]);
+    }
+    return r;
+  }
+
+  [[nodiscard]]
+  Index row_position(std::size_t r) const {
+    Index p{};
+    for (auto d{1UZ}; d < N; ++d) {
+      p[d] = static_cast<int>(r % static_cast<std::size_t>(shape_[d]));
+      r /= static_cast<std::size_t>(shape_[d]);
+    }
+    return p;
+  }
+
+  [[nodiscard]]
+  bool test(const Index& p) const {
+    if (not contains(p)) {
+      return false;
+    }
+    const auto x{static_cast<std::size_t>(p[0])};
+    return (row(row_index(p))[x / word_bits] >> (x % word_bits)) & 1U;
+  }
+
+  void set(const Index& p, bool value = true) {
+    if (not contains(p)) {
+      throw std::out_of_range("position is outside the board");
+    }
+    const auto x{static_cast<std::size_t>(p[0])};
+    fill_bits(row(row_index(p)), x, x + 1, value);
+  }
+
+  [[nodiscard]]
+  std::size_t count() const {
+    auto n{0UZ};
+    for (Word w : words_) {
+      n += static_cast<std::size_t>(std::popcount(w));
+    }
+    return n;
+  }
+
+  // Copy with margin extra cells on both sides of every axis, new cells are set to fill
+  [[nodiscard]]
+  Board grown(const int margin, const bool fill = false) const {
+    Index shape{shape_};
+    for (int& n : shape) {
+      n += 2 * margin;
+    }
+    Board out(shape);
+    const auto offset{static_cast<std::size_t>(margin)};
+    if (fill) {
+      for (auto r{0UZ}; r < out.n_rows(); ++r) {
+        fill_bits(out.row(r), 0, static_cast<std::size_t>(shape[0]), true);
+      }
+    }
+    for (auto r{0UZ}; r < n_rows(); ++r) {
+      auto p{row_position(r)};
+      for (auto d{1UZ}; d < N; ++d) {
+        p[d] += margin;
+      }
+      auto dst{out.row(out.row_index(p))};
+      fill_bits(dst, offset, offset + static_cast<std::size_t>(shape_[0]), false);
+      const auto shift{offset % word_bits};
+      for (auto k{0UZ}; k < row_words_; ++k) {
+        const auto w{row(r)[k]};
+        const auto i{k + offset / word_bits};
+        dst[i] |= w << shift;
+        if (shift > 0 and i + 1 < dst.size()) {
+          dst[i + 1] |= w >> (word_bits - shift);
+        }
+      }
+    }
+    return out;
+  }
+
+  Board& operator|=(const Board& other) {
+    if (shape_ != other.shape_) {
+      throw std::invalid_argument("boards must have the same shape");
+    }
+    std::ranges::transform(words_, other.words_, words_.begin(), std::bit_or{});
+    return *this;
+  }
+
+  bool operator==(const Board&) const = default;
+};
+
+// Bit-sliced number of live cells in the Moore neighbourhood of every cell, including the cell.
+// Cells outside the board are dead.
+// The result has one counter word per word of the board.
+template <std::size_t N>
+auto moore_counts(const Board<N>& board) {
+  using Total = Counts<moore_bits(N)>;
+  const auto row_words{board.row_words()};
+  const auto n_rows{board.n_rows()};
+
+  // sums of the three cells x - 1, x, x + 1
+  std::vector<Counts<2>> row_sums(board.words().size());
+  for (auto r{0UZ}; r < n_rows; ++r) {
+    const auto row{board.row(r)};
+    for (auto k{0UZ}; k < row_words; ++k) {
+      const auto a{west_of(row, k)};
+      const auto b{row[k]};
+      const auto c{east_of(row, k)};
+      row_sums[r * row_words + k].planes = {a ^ b ^ c, (a & b) | (c & (a ^ b))};
+    }
+  }
+
+  std::vector<Total> totals(board.words().size());
+  std::vector<std::size_t> adjacent_rows;
+  for (auto r{0UZ}; r < n_rows; ++r) {
+    adjacent_rows.clear();
+    const auto center{board.row_position(r)};
+    // all rows whose coordinates after the first axis differ from center by at most one
+    auto d{center};
+    for (auto i{1UZ}; i < N; ++i) {
+      d[i] = -1;
+    }
+    for (;;) {
+      auto p{center};
+      for (auto i{1UZ}; i < N; ++i) {
+        p[i] += d[i];
+      }
+      bool inside{true};
+      for (auto i{1UZ}; i < N; ++i) {
+        inside = inside and static_cast<unsigned>(p[i]) < static_cast<unsigned>(board.shape()[i]);
+      }
+      if (inside) {
+        adjacent_rows.push_back(board.row_index(p));
+      }
+      auto i{1UZ};
+      for (; i < N and d[i] == 1; ++i) {
+        d[i] = -1;
+      }
+      if (i == N) {
+        break;
+      }
+      d[i] += 1;
+    }
+    for (auto k{0UZ}; k < row_words; ++k) {
+      auto& total{totals[r * row_words + k]};
+      for (const auto adj : adjacent_rows) {
+        total.add(row_sums[adj * row_words + k]);
+      }
+    }
+  }
+  return totals;
+}
+
+// Next generation of a board where next(alive, total) maps a word of cells and their moore_counts
+// to the next state of those cells
+template <std::size_t N, typename Rule>
+Board<N> step(const Board<N>& board, Rule&& next) {
+  const auto totals{moore_counts(board)};
+  Board<N> out(board.shape());
+  const auto cells{board.words()};
+  auto out_cells{out.words()};
+  for (auto i{0UZ}; i < cells.size(); ++i) {
+    out_cells[i] = std::invoke(next, cells[i], totals[i]);
+  }
+  if (const auto row_words{out.row_words()}; row_words > 0) {
+    const auto mask{out.last_word_mask()};
+    for (auto r{0UZ}; r < out.n_rows(); ++r) {
+      out.row(r)[row_words - 1] &= mask;
+    }
+  }
+  return out;
+}
+
+// B3/S23 rule of Conway's Game of Life, total includes the cell itself
+template <std::size_t Bits>
+Word conway(const Word alive, const Counts<Bits>& total) {
+  return total.equals(3) | (alive & total.equals(4));
+}
+
+// Three cells [x, x + 2] of a row, cell x in the lowest bit
+unsigned window3(std::span<const Word> row, const std::size_t x) {
+  const auto k{x / word_bits};
+  const auto shift{x % word_bits};
+  auto w{row[k] >> shift};
+  if (shift > word_bits - 3 and k + 1 < row.size()) {
+    w |= row[k + 1] << (word_bits - shift);
+  }
+  return static_cast<unsigned>(w & 7U);
+}
+
+// Next generation of an unbounded 2D automaton where each cell becomes table(i) for the 9-bit
+// index i read from its 3x3 neighbourhood in reading order, most significant bit first.
+// Cells outside the board are all background, the board grows by one cell on each side.
+template <typename Table>
+Board<2> step_window(const Board<2>& board, Table&& table, const bool background) {
+  constexpr std::array<unsigned, 8> reversed{0, 4, 2, 6, 1, 5, 3, 7};
+  const auto padded{board.grown(2, background)};
+  Board<2> out(board.grown(1).shape());
+  const auto [width, height]{out.shape()};
+  for (int y{}; y < height; ++y) {
+    const auto r{static_cast<std::size_t>(y)};
+    const auto top{padded.row(r)};
+    const auto mid{padded.row(r + 1)};
+    const auto bottom{padded.row(r + 2)};
+    auto dst{out.row(r)};
+    for (auto x{0UZ}; x < static_cast<std::size_t>(width); ++x) {
+      const auto i{
+          reversed[window3(top, x)] << 6 | reversed[window3(mid, x)] << 3
+          | reversed[window3(bottom, x)]
+      };
+      if (std::invoke(table, i)) {
+        dst[x / word_bits] |= Word{1} << (x % word_bits);
+      }
+    }
+  }
+  return out;
+}
+
+}  // namespace cellular
+
+#endif  // CELLULAR_HEADER_INCLUDED
@@ -1,15 +1,19 @@
 #ifndef INTCODE_HEADER_INCLUDED
 #define INTCODE_HEADER_INCLUDED
 
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <charconv>
 #include <cstdlib>
 #include <deque>
 #include <format>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <ranges>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -53,66 +57,243 @@ enum class Mode : int {
   relative_address = 2,
 };
 
-class IntCode {
+struct Instruction {
+  Op op{};
+  Mode mode1{};
+  Mode mode2{};
+  Mode mode3{};
+};
+
+// Instruction{} if ins is not a valid instruction
+Instruction try_decode(const long ins) noexcept {
+  if (ins < 0) {
+    return {};
+  }
+  switch (ins % 100) {
+    case std::to_underlying(Op::add):
+    case std::to_underlying(Op::multiply):
+    case std::to_underlying(Op::input):
+    case std::to_underlying(Op::output):
+    case std::to_underlying(Op::jump_if_nonzero):
+    case std::to_underlying(Op::jump_if_zero):
+    case std::to_underlying(Op::less):
+    case std::to_underlying(Op::equal):
+    case std::to_underlying(Op::update_rel_base):
+    case std::to_underlying(Op::end):
+      return {
+          Op(ins % 100),
+          Mode(ins / 100 % 10),
+          Mode(ins / 1'000 % 10),
+          Mode(ins / 10'000 % 10),
+      };
+  }
+  return {};
+}
+
+Instruction decode(const long ins) {
+  if (ins < 0) {
+    throw std::runtime_error(std::format("cannot decode negative instruction {}", ins));
+  }
+  int2op(static_cast<int>(ins % 100));
+  return try_decode(ins);
+}
+
+// Fixed size pages for the program and nearby addresses, sparse overflow page for the rest.
+// Pages are shared copy-on-write, so copying a Memory costs O(pages) and the copy pays only for
+// the pages it writes to.
+// Every value is decoded when it is stored, so reading the instruction cache never writes to a
+// page that might be shared.
+class Memory {
  public:
   using Int = long;
 
-  std::deque<Int> input, output;
-
  private:
-  std::unordered_map<Int, Int> memory;
+  static constexpr Int page_bits{9};
+  static constexpr Int page_size{1L << page_bits};
+  static constexpr Int paged_limit{1L << 22};
 
-  Int ip{}, relbase{};
+  struct Page {
+    std::array<Int, page_size> values{};
+    std::array<Instruction, page_size> decoded{};
+  };
+
+  std::vector<std::shared_ptr<Page>> pages;
+  std::unordered_map<Int, Int> sparse;
 
-  [[nodiscard]] auto parse_instruction(auto ins) const noexcept {
-    std::array<int, 5> d;
-    for (int& x : d) {
-      auto [q, r]{std::ldiv(ins, 10)};
-      ins = q;
-      x = r;
+  [[nodiscard]] const Page* find_page(const Int i) const noexcept {
+    if (0 <= i and i < paged_limit) [[likely]] {
+      if (const auto p{static_cast<std::size_t>(i >> page_bits)}; p < pages.size()) {
+        return pages[p].get();
+      }
     }
-    return std::tuple{
-        int2op(d[0] + d[1] * 10),
-        Mode{d[2]},
-        Mode{d[3]},
-        Mode{d[4]},
-    };
+    return nullptr;
   }
 
-  [[nodiscard]] Int next() {
-    if (0 <= ip) {
-      return load(ip++, Mode::address);
+  [[nodiscard]] Page& writable_page(const Int i) {
+    const auto p{static_cast<std::size_t>(i >> page_bits)};
+    if (p >= pages.size()) {
+      pages.resize(p + 1);
     }
-    throw std::runtime_error("instruction pointer is out of bounds");
+    auto& page{pages[p]};
+    if (not page) {
+      page = std::make_shared<Page>();
+    } else if (page.use_count() > 1) {
+      page = std::make_shared<Page>(*page);
+    }
+    return *page;
   }
 
  public:
-  IntCode() = default;
-  IntCode(std::ranges::input_range auto&& program) {
-    for (auto [i, value] : std::views::zip(std::views::iota(0UZ), program)) {
-      memory[i] = value;
+  Memory() = default;
+  explicit Memory(std::ranges::input_range auto&& program) {
+    for (auto [i, value] : std::views::zip(std::views::iota(0L), program)) {
+      store(i, value);
+    }
+  }
+
+  [[nodiscard]] Int load(const Int i) const {
+    if (const Page* page{find_page(i)}) [[likely]] {
+      return page->values[i & (page_size - 1)];
+    }
+    if (const auto it{sparse.find(i)}; it != sparse.end()) {
+      return it->second;
+    }
+    return 0;
+  }
+
+  void store(const Int i, const Int value) {
+    if (0 <= i and i < paged_limit) [[likely]] {
+      auto& page{writable_page(i)};
+      const auto k{i & (page_size - 1)};
+      page.decoded[k] = try_decode(value);
+      page.values[k] = value;
+    } else {
+      sparse[i] = value;
+    }
+  }
+
+  [[nodiscard]] Instruction instruction(const Int i) const {
+    if (const Page* page{find_page(i)}) [[likely]] {
+      if (const auto ins{page->decoded[i & (page_size - 1)]}; ins.op != Op{}) {
+        return ins;
+      }
     }
+    return decode(load(i));
   }
+};
+
+// Growable ring buffer for the input and output queues of an IntCode.
+// Unlike std::deque, pushing and popping never allocates once the buffer has grown large enough.
+template <typename T>
+class Queue {
+  std::vector<T> buffer;
+  std::size_t head{};
+  std::size_t tail{};
+
+  [[nodiscard]] std::size_t mask() const noexcept {
+    return buffer.size() - 1;
+  }
+
+  void grow() {
+    std::vector<T> next(std::max(16UZ, 2 * buffer.size()));
+    for (auto i{head}; i < tail; ++i) {
+      next[i - head] = buffer[i & mask()];
+    }
+    tail -= head;
+    head = 0;
+    buffer = std::move(next);
+  }
+
+ public:
+  [[nodiscard]] bool empty() const noexcept {
+    return head == tail;
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return tail - head;
+  }
+
+  [[nodiscard]] const T& front() const {
+    return buffer[head & mask()];
+  }
+
+  [[nodiscard]] const T& back() const {
+    return buffer[(tail - 1) & mask()];
+  }
+
+  void push_back(const T& value) {
+    if (size() == buffer.size()) {
+      grow();
+    }
+    buffer[tail++ & mask()] = value;
+  }
+
+  void append_range(std::ranges::input_range auto&& r) {
+    for (auto&& value : r) {
+      push_back(static_cast<T>(value));
+    }
+  }
+
+  void pop_front() {
+    head += 1;
+  }
+
+  void clear() noexcept {
+    head = tail = 0;
+  }
+};
+
+enum class Status : unsigned char {
+  needs_input,
+  output_ready,
+  halted,
+};
+
+class IntCode {
+ public:
+  using Int = long;
+
+  Queue<Int> input, output;
 
-  [[nodiscard]] Int load(const auto i, const Mode mode) const {
+  // Cleared by code generated with src/tools/intcode2cpp when the program overwrites one of its
+  // own instructions, after which the machine must be interpreted
+  bool native_code_valid{true};
+
+ private:
+  Memory memory;
+
+  Int ip{}, relbase{};
+
+  [[nodiscard]] Int arg(const int n) const {
+    return memory.load(ip + n);
+  }
+
+ public:
+  IntCode() = default;
+  IntCode(std::ranges::input_range auto&& program) : memory(program) {
+  }
+
+  [[nodiscard]] Int load(const Int i, const Mode mode) const {
     switch (mode) {
       case Mode::immediate:
         return i;
       case Mode::address:
-        return memory.contains(i) ? memory.at(i) : 0;
+        return memory.load(i);
       case Mode::relative_address:
-        return load(i + relbase, Mode::address);
+        return memory.load(i + relbase);
     }
   }
 
-  Int& store(const auto i, Int value, const Mode mode) {
+  void store(const Int i, Int value, const Mode mode) {
     switch (mode) {
       case Mode::immediate:
         throw std::runtime_error("cannot store in immediate mode");
       case Mode::address:
-        return (memory[i] = value);
+        memory.store(i, value);
+        break;
       case Mode::relative_address:
-        return store(i + relbase, value, Mode::address);
+        memory.store(i + relbase, value);
+        break;
     }
   }
 
@@ -138,90 +319,201 @@ class IntCode {
     return pop_queue(output);
   }
 
-  [[nodiscard]] Int compute(const Op op, const Int lhs, const Int rhs) const {
-    switch (op) {
-      case Op::add:
-        return lhs + rhs;
-      case Op::multiply:
-        return lhs * rhs;
-      case Op::less:
-        return lhs < rhs;
-      case Op::equal:
-        return lhs == rhs;
-      default:
-        throw std::runtime_error(
-            std::format("Op {} is not a binary operator", std::to_underlying(op))
-        );
+  // Execute one instruction, or return false without side effects if it needs missing input
+  [[nodiscard]] bool try_step() {
+    if (ip < 0) {
+      throw std::runtime_error("instruction pointer is out of bounds");
     }
-  }
-
-  void do_step() {
-    auto [op, mode1, mode2, mode3]{parse_instruction(next())};
+    const auto [op, mode1, mode2, mode3]{memory.instruction(ip)};
     switch (op) {
-      case Op::add:
-      case Op::multiply:
-      case Op::less:
+      case Op::add: {
+        store(arg(3), load(arg(1), mode1) + load(arg(2), mode2), mode3);
+        ip += 4;
+      } break;
+      case Op::multiply: {
+        store(arg(3), load(arg(1), mode1) * load(arg(2), mode2), mode3);
+        ip += 4;
+      } break;
+      case Op::less: {
+        store(arg(3), load(arg(1), mode1) < load(arg(2), mode2), mode3);
+        ip += 4;
+      } break;
       case Op::equal: {
-        const Int lhs{load(next(), mode1)};
-        const Int rhs{load(next(), mode2)};
-        const Int out{compute(op, lhs, rhs)};
-        store(next(), out, mode3);
+        store(arg(3), load(arg(1), mode1) == load(arg(2), mode2), mode3);
+        ip += 4;
       } break;
       case Op::input: {
-        store(next(), pop_input(), mode1);
+        if (input.empty()) {
+          return false;
+        }
+        store(arg(1), pop_input(), mode1);
+        ip += 2;
       } break;
       case Op::output: {
-        output.push_back(load(next(), mode1));
+        output.push_back(load(arg(1), mode1));
+        ip += 2;
+      } break;
+      case Op::jump_if_nonzero: {
+        ip = load(arg(1), mode1) != 0 ? load(arg(2), mode2) : ip + 3;
       } break;
-      case Op::jump_if_nonzero:
       case Op::jump_if_zero: {
-        const Int flag{load(next(), mode1)};
-        const Int jump{load(next(), mode2)};
-        if ((flag != 0) == (op == Op::jump_if_nonzero)) {
-          ip = jump;
-        }
+        ip = load(arg(1), mode1) == 0 ? load(arg(2), mode2) : ip + 3;
       } break;
       case Op::update_rel_base: {
-        relbase += load(next(), mode1);
+        relbase += load(arg(1), mode1);
+        ip += 2;
       } break;
       case Op::end: {
         ip = std::numeric_limits<Int>::min();
       } break;
     }
+    return true;
+  }
+
+  void do_step() {
+    if (not try_step()) {
+      throw std::runtime_error("cannot pop from empty input queue");
+    }
   }
 
   [[nodiscard]] bool is_done() const noexcept {
     return ip < 0;
   }
 
-  void run_to_end() {
-    while (not is_done()) {
+  // Registers for code generated with src/tools/intcode2cpp
+  [[nodiscard]] Int& instruction_pointer() noexcept {
+    return ip;
+  }
+
+  [[nodiscard]] Int& relative_base() noexcept {
+    return relbase;
+  }
+
+  // Independent copy of this machine, memory pages are shared until either side writes to them
+  [[nodiscard]] IntCode fork() const {
+    return *this;
+  }
+
+  struct Snapshot {
+    Memory memory;
+    Int ip{}, relbase{};
+    Queue<Int> input, output;
+    bool native_code_valid{};
+  };
+
+  [[nodiscard]] Snapshot snapshot() const {
+    return {memory, ip, relbase, input, output, native_code_valid};
+  }
+
+  void restore(const Snapshot& s) {
+    memory = s.memory;
+    ip = s.ip;
+    relbase = s.relbase;
+    input = s.input;
+    output = s.output;
+    native_code_valid = s.native_code_valid;
+  }
+
+  // Step until halted or until keep_going() returns false, checked before every step
+  void run_while(auto&& keep_going) {
+    while (not is_done() and keep_going()) {
       do_step();
     }
   }
 
+  void run_to_end() {
+    run_while([] { return true; });
+  }
+
   void run_while_input() {
-    while (not is_done() and not input.empty()) {
-      do_step();
-    }
+    run_while([this] { return not input.empty(); });
   }
 
   auto run_until_output() {
-    while (not is_done() and output.empty()) {
-      do_step();
-    }
+    run_while([this] { return output.empty(); });
     return pop_output();
   }
+
+  // Run until the machine halts, waits for input that has not arrived yet, or has written at
+  // least max_output values to the output queue
+  Status run_until_blocked(const std::size_t max_output = std::numeric_limits<std::size_t>::max()) {
+    while (not is_done()) {
+      if (output.size() >= max_output) {
+        return Status::output_ready;
+      }
+      if (not try_step()) {
+        return Status::needs_input;
+      }
+    }
+    return Status::halted;
+  }
+};
+
+// Machines that only communicate through each other's input queues.
+// run_next wakes only machines that have received input since they last blocked.
+class Network {
+  std::vector<IntCode> machines;
+  std::vector<bool> is_ready;
+  std::deque<std::size_t> ready;
+
+ public:
+  explicit Network(std::vector<IntCode> ms) : machines(std::move(ms)), is_ready(machines.size()) {
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return machines.size();
+  }
+
+  [[nodiscard]] IntCode& at(const std::size_t i) {
+    return machines.at(i);
+  }
+
+  [[nodiscard]] bool is_idle() const noexcept {
+    return ready.empty();
+  }
+
+  void send(const std::size_t dst, const auto... values) {
+    auto& ic{machines.at(dst)};
+    (ic.input.push_back(values), ...);
+    if (not is_ready[dst]) {
+      is_ready[dst] = true;
+      ready.push_back(dst);
+    }
+  }
+
+  // Run the next machine with pending input until it blocks, returns its index
+  std::optional<std::size_t> run_next() {
+    if (ready.empty()) {
+      return std::nullopt;
+    }
+    const auto i{ready.front()};
+    ready.pop_front();
+    is_ready[i] = false;
+    machines[i].run_until_blocked();
+    return i;
+  }
 };
 
-std::vector<IntCode::Int> parse_program(std::string input) {
-  std::ranges::replace(input, ',', ' ');
-  std::istringstream is{input};
-  auto program{std::views::istream<IntCode::Int>(is) | std::ranges::to<std::vector>()};
-  if (is.eof()) {
-    return program;
+std::vector<IntCode::Int> parse_program(std::string_view input) {
+  const auto is_sep{[](char ch) {
+    return ch == ',' or std::isspace(static_cast<unsigned char>(ch));
+  }};
+  std::vector<IntCode::Int> program;
+  const char* const end{input.data() + input.size()};
+  for (const char* p{input.data()}; p != end;) {
+    if (is_sep(*p)) {
+      ++p;
+      continue;
+    }
+    IntCode::Int value{};
+    const auto [next, ec]{std::from_chars(p, end, value)};
+    if (ec != std::errc{} or (next != end and not is_sep(*next))) {
+      throw std::runtime_error("invalid IntCode program, parsing failed");
+    }
+    program.push_back(value);
+    p = next;
   }
-  throw std::runtime_error("invalid IntCode program, parsing failed");
+  return program;
 }
 
 }  // namespace intcode
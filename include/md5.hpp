@@ -4,10 +4,14 @@
 #include <algorithm>
 #include <array>
 #include <bit>
-#include <cmath>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
-#include <format>
+#include <cstdlib>
 #include <ranges>
+#include <string>
+#include <string_view>
 
 // MD5 algorithm references (accessed 2024-01-11)
 // 1. https://datatracker.ietf.org/doc/html/rfc1321
@@ -21,54 +25,126 @@ using Chunk = uint32_t;
 using Input = std::array<Chunk, 16>;
 using State = std::array<Chunk, 4>;
 
-void compute_chunk(const Input& input, State& state) {
-  static bool first_call{true};
-  static std::array<Chunk, 64> T{};
-  static std::array<Chunk, 64> rotations{};
+// Number of messages hashed in parallel by sum_batch, one per SIMD lane
+#if defined(__AVX512F__)
+inline constexpr std::size_t lanes{16};
+#elif defined(__AVX2__)
+inline constexpr std::size_t lanes{8};
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+inline constexpr std::size_t lanes{4};
+#else
+inline constexpr std::size_t lanes{1};
+#endif
 
-  using std::views::iota;
-  using std::views::zip;
+namespace detail {
 
-  if (first_call) {
-    first_call = false;
+constexpr State initial_state{
+    std::byteswap(0x01234567U),
+    std::byteswap(0x89abcdefU),
+    std::byteswap(0xfedcba98U),
+    std::byteswap(0x76543210U),
+};
 
-    for (auto&& [i, t] : zip(iota(1UZ), T)) {
-      t = static_cast<Chunk>((1LL << 32) * std::abs(std::sin(i)));
-    }
+// floor(abs(sin(i + 1)) * 2^32)
+constexpr std::array<Chunk, 64> T{
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+
+constexpr auto rotations{[] {
+  constexpr std::array<int, 16> rot{7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+  std::array<int, 64> res{};
+  for (auto i{0UZ}; i < res.size(); ++i) {
+    res[i] = rot[4 * (i / 16) + i % 4];
+  }
+  return res;
+}()};
 
-    constexpr std::array<Chunk, 16> rot{7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
-    for (auto&& [i, s] : zip(iota(0UZ), rotations)) {
-      s = rot[4 * (i / 16) + i % 4];
+constexpr auto input_index{[] {
+  std::array<std::size_t, 64> res{};
+  for (auto i{0UZ}; i < res.size(); ++i) {
+    switch (i / 16) {
+      case 0:
+        res[i] = i;
+        break;
+      case 1:
+        res[i] = (5 * i + 1) % 16;
+        break;
+      case 2:
+        res[i] = (3 * i + 5) % 16;
+        break;
+      case 3:
+        res[i] = (7 * i) % 16;
+        break;
     }
   }
+  return res;
+}()};
+
+// std::rotl does not accept vector types
+template <typename Word>
+constexpr Word rotl(const Word x, const int s) {
+  return (x << s) | (x >> (32 - s));
+}
+
+template <std::size_t N>
+struct lane_word {
+  typedef Chunk type __attribute__((vector_size(N * sizeof(Chunk))));
+};
 
+template <>
+struct lane_word<1> {
+  using type = Chunk;
+};
+
+}  // namespace detail
+
+// N independent Chunks, one per lane, using clang/gcc vector extensions
+template <std::size_t N>
+using LaneWord = typename detail::lane_word<N>::type;
+
+template <typename Word>
+void compute_chunk(const std::array<Word, 16>& input, std::array<Word, 4>& state) {
   auto a{state[0]};
   auto b{state[1]};
   auto c{state[2]};
   auto d{state[3]};
 
-  const auto update{[&](const auto i, auto f, const auto g) {
-    f += a + T[i] + input[g];
+  const auto update{[&](const auto i, Word f) {
+    f += a + detail::T[i] + input[detail::input_index[i]];
     a = d;
     d = c;
     c = b;
-    const auto s{rotations[i]};
-    b += std::rotl(f, s);
+    b += detail::rotl(f, detail::rotations[i]);
   }};
 
   {
     unsigned i{};
     for (; i < 16u; ++i) {
-      update(i, (b & c) | (~b & d), i);
+      update(i, (b & c) | (~b & d));
     }
     for (; i < 32u; ++i) {
-      update(i, (b & d) | (~d & c), (5 * i + 1) % 16);
+      update(i, (b & d) | (~d & c));
     }
     for (; i < 48u; ++i) {
-      update(i, b ^ c ^ d, (3 * i + 5) % 16);
+      update(i, b ^ c ^ d);
     }
     for (; i < 64u; ++i) {
-      update(i, c ^ (b | ~d), (7 * i) % 16);
+      update(i, c ^ (b | ~d));
     }
   }
 
@@ -79,12 +155,7 @@ void compute_chunk(const Input& input, State& state) {
 }
 
 State sum(std::ranges::range auto&& msg) {
-  State state{
-      std::byteswap(0x01234567),
-      std::byteswap(0x89abcdef),
-      std::byteswap(0xfedcba98),
-      std::byteswap(0x76543210),
-  };
+  State state{detail::initial_state};
 
   Input input;
   input.fill(0);
@@ -128,12 +199,266 @@ Chunk sum32bit(std::ranges::range auto&& msg) {
   return std::byteswap(sum(msg)[0]);
 }
 
-std::string hexdigest(const State& state) {
-  return std::ranges::fold_left(state, std::string{}, [](auto&& res, auto&& chunk) {
-    return std::format("{}{:08x}", res, std::byteswap(chunk));
+constexpr std::size_t chunk_count(std::size_t msg_size) {
+  return (msg_size + 8) / 64 + 1;
+}
+
+// Chunk number i of msg after appending the 0x80 terminator, zero padding, and the bit length
+constexpr Input padded_chunk(std::string_view msg, const std::size_t i) {
+  Input input{};
+  for (auto pos{64 * i}, end{pos + 64}; pos < end; ++pos) {
+    Chunk b{};
+    if (pos < msg.size()) {
+      b = static_cast<Byte>(msg[pos]);
+    } else if (pos == msg.size()) {
+      b = 0x80;
+    }
+    input[(pos % 64) / 4] |= b << (8 * (pos % 4));
+  }
+  if (i + 1 == chunk_count(msg.size())) {
+    const auto n_bits{8 * static_cast<uint64_t>(msg.size())};
+    input[14] = static_cast<Chunk>(n_bits);
+    input[15] = static_cast<Chunk>(n_bits >> 32);
+  }
+  return input;
+}
+
+namespace detail {
+
+template <std::size_t N>
+Chunk get_lane(const LaneWord<N>& w, const std::size_t lane) {
+  if constexpr (N == 1) {
+    return w;
+  } else {
+    return w[lane];
+  }
+}
+
+template <std::size_t N>
+void set_lane(LaneWord<N>& w, const std::size_t lane, const Chunk value) {
+  if constexpr (N == 1) {
+    w = value;
+  } else {
+    w[lane] = value;
+  }
+}
+
+template <std::size_t N, std::size_t K>
+std::array<LaneWord<N>, K> to_lanes(const std::array<std::array<Chunk, K>, N>& chunks) {
+  std::array<LaneWord<N>, K> words;
+  for (auto lane{0UZ}; lane < N; ++lane) {
+    for (auto k{0UZ}; k < K; ++k) {
+      set_lane<N>(words[k], lane, chunks[lane][k]);
+    }
+  }
+  return words;
+}
+
+template <std::size_t N, std::size_t K>
+std::array<std::array<Chunk, K>, N> from_lanes(const std::array<LaneWord<N>, K>& words) {
+  std::array<std::array<Chunk, K>, N> chunks;
+  for (auto lane{0UZ}; lane < N; ++lane) {
+    for (auto k{0UZ}; k < K; ++k) {
+      chunks[lane][k] = get_lane<N>(words[k], lane);
+    }
+  }
+  return chunks;
+}
+
+// Hash n_chunks[lane] chunks in each of the N lanes, all starting from the same state.
+// get_chunk(lane, i) returns chunk number i of the message in the given lane.
+template <std::size_t N>
+std::array<State, N> sum_lanes(
+    const State& init,
+    const std::array<std::size_t, N>& n_chunks,
+    auto&& get_chunk
+) {
+  std::array<LaneWord<N>, 4> state;
+  for (auto&& [w, x] : std::views::zip(state, init)) {
+    w = LaneWord<N>{} + x;
+  }
+
+  std::array<State, N> result;
+  for (auto i{0UZ}; i < std::ranges::max(n_chunks); ++i) {
+    std::array<Input, N> input;
+    for (auto lane{0UZ}; lane < N; ++lane) {
+      if (i < n_chunks[lane]) {
+        input[lane] = get_chunk(lane, i);
+      } else {
+        input[lane].fill(0);
+      }
+    }
+    compute_chunk(to_lanes(input), state);
+    const auto lane_state{from_lanes<N>(state)};
+    for (auto lane{0UZ}; lane < N; ++lane) {
+      if (i + 1 == n_chunks[lane]) {
+        result[lane] = lane_state[lane];
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace detail
+
+// Hash N messages at once, each in its own SIMD lane.
+// Messages of different length are allowed, but the batch runs as many chunks as the longest one.
+template <typename Msg, std::size_t N>
+  requires(std::convertible_to<const Msg&, std::string_view> and std::has_single_bit(N))
+std::array<State, N> sum_batch(const std::array<Msg, N>& msgs) {
+  std::array<std::size_t, N> n_chunks;
+  std::ranges::transform(msgs, n_chunks.begin(), [](std::string_view msg) {
+    return chunk_count(msg.size());
+  });
+  return detail::sum_lanes<N>(detail::initial_state, n_chunks, [&msgs](auto lane, auto i) {
+    return padded_chunk(msgs[lane], i);
   });
 }
 
+template <typename Msg, std::size_t N>
+std::array<Chunk, N> sum32bit_batch(const std::array<Msg, N>& msgs) {
+  std::array<Chunk, N> result;
+  std::ranges::transform(sum_batch(msgs), result.begin(), [](const State& state) {
+    return std::byteswap(state[0]);
+  });
+  return result;
+}
+
+// MD5 of a fixed prefix followed by a decimal number, e.g. "abcdef609043".
+// Full chunks of the prefix are hashed once and the number is written into a fixed buffer,
+// so no strings are formatted or allocated per number.
+class PrefixHasher {
+  using Buffer = std::array<char, 128>;
+
+  State prefix_state{detail::initial_state};
+  std::size_t prefix_state_size{};
+  Buffer tail{};
+  std::size_t tail_size{};
+
+  // The last one or two chunks of prefix + n
+  [[nodiscard]] std::size_t make_chunks(const uint64_t n, std::array<Input, 2>& chunks) const {
+    Buffer buf{tail};
+    const auto end{std::to_chars(buf.data() + tail_size, buf.data() + tail_size + 20, n).ptr};
+    const auto size{static_cast<std::size_t>(end - buf.data())};
+    buf[size] = static_cast<char>(0x80);
+
+    const auto n_chunks{chunk_count(size)};
+    auto n_bits{8 * static_cast<uint64_t>(prefix_state_size + size)};
+    for (auto i{64 * n_chunks - 8}; i < 64 * n_chunks; ++i) {
+      buf[i] = static_cast<char>(n_bits & 0xff);
+      n_bits >>= 8;
+    }
+
+    chunks.fill({});
+    for (auto i{0UZ}; i < 64 * n_chunks; ++i) {
+      chunks[i / 64][(i % 64) / 4] |= Chunk{static_cast<Byte>(buf[i])} << (8 * (i % 4));
+    }
+    return n_chunks;
+  }
+
+ public:
+  explicit PrefixHasher(std::string_view prefix) : prefix_state_size{64 * (prefix.size() / 64)} {
+    for (auto i{0UZ}; 64 * i < prefix_state_size; ++i) {
+      compute_chunk(padded_chunk(prefix, i), prefix_state);
+    }
+    const auto rest{prefix.substr(prefix_state_size)};
+    std::ranges::copy(rest, tail.begin());
+    tail_size = rest.size();
+  }
+
+  [[nodiscard]] State sum(const uint64_t n) const {
+    std::array<Input, 2> chunks;
+    State state{prefix_state};
+    for (auto i{0UZ}, n_chunks{make_chunks(n, chunks)}; i < n_chunks; ++i) {
+      compute_chunk(chunks[i], state);
+    }
+    return state;
+  }
+
+  [[nodiscard]] Chunk sum32bit(const uint64_t n) const {
+    return std::byteswap(sum(n)[0]);
+  }
+
+  // Hash prefix + n for N consecutive numbers, starting at first
+  template <std::size_t N = lanes>
+    requires(std::has_single_bit(N))
+  [[nodiscard]] std::array<State, N> sum_batch(const uint64_t first) const {
+    std::array<std::array<Input, 2>, N> chunks;
+    std::array<std::size_t, N> n_chunks;
+    for (auto lane{0UZ}; lane < N; ++lane) {
+      n_chunks[lane] = make_chunks(first + lane, chunks[lane]);
+    }
+    return detail::sum_lanes<N>(prefix_state, n_chunks, [&chunks](auto lane, auto i) {
+      return chunks[lane][i];
+    });
+  }
+
+  template <std::size_t N = lanes>
+  [[nodiscard]] std::array<Chunk, N> sum32bit_batch(const uint64_t first) const {
+    std::array<Chunk, N> result;
+    std::ranges::transform(sum_batch<N>(first), result.begin(), [](const State& state) {
+      return std::byteswap(state[0]);
+    });
+    return result;
+  }
+};
+
+// The padded input chunk of the 32 character lowercase hexdigest of state.
+// Nibbles are converted to ASCII with SWAR arithmetic so that all lanes of a LaneWord are
+// converted at once.
+template <typename Word>
+constexpr std::array<Word, 16> hexdigest_chunk(const std::array<Word, 4>& state) {
+  const auto to_ascii{[](const Word nibbles) -> Word {
+    const Word is_alpha{((nibbles + 0x06060606U) >> 4) & 0x01010101U};
+    return nibbles + 0x30303030U + is_alpha * ('a' - '0' - 10);
+  }};
+
+  std::array<Word, 16> input{};
+  for (auto i{0UZ}; i < state.size(); ++i) {
+    const Word x{state[i]};
+    // hex characters of the first two bytes of x, then the last two
+    for (auto half{0UZ}; half < 2; ++half) {
+      const Word y{x >> (16 * half)};
+      input[2 * i + half] = to_ascii(
+          ((y >> 4) & 0xfU) | ((y & 0xfU) << 8) | (((y >> 12) & 0xfU) << 16)
+          | (((y >> 8) & 0xfU) << 24)
+      );
+    }
+  }
+  input[8] = Word{} + 0x80U;
+  input[14] = Word{} + 8U * 32U;
+  return input;
+}
+
+// Apply state = md5(hexdigest(state)) rounds times
+template <typename Word>
+void stretch(std::array<Word, 4>& state, const int rounds) {
+  for (int r{}; r < rounds; ++r) {
+    const auto input{hexdigest_chunk(state)};
+    for (auto&& [w, x] : std::views::zip(state, detail::initial_state)) {
+      w = Word{} + x;
+    }
+    compute_chunk(input, state);
+  }
+}
+
+template <std::size_t N>
+  requires(std::has_single_bit(N))
+std::array<State, N> stretch_batch(const std::array<State, N>& states, const int rounds) {
+  auto words{detail::to_lanes(states)};
+  stretch(words, rounds);
+  return detail::from_lanes<N>(words);
+}
+
+std::string hexdigest(const State& state) {
+  const auto input{hexdigest_chunk(state)};
+  std::string res(32, 0);
+  for (auto&& [i, ch] : std::views::zip(std::views::iota(0UZ), res)) {
+    ch = static_cast<char>((input[i / 4] >> (8 * (i % 4))) & 0xff);
+  }
+  return res;
+}
+
 }  // namespace md5
 
 #endif  // MD5_HEADER_INCLUDED
@@ -0,0 +1,301 @@
+#ifndef PARALLEL_HEADER_INCLUDED
+#define PARALLEL_HEADER_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace parallel {
+
+// Long-lived worker threads, each owning a task deque.
+// Workers pop from the back of their own deque and steal from the front of the others.
+class ThreadPool {
+  using Task = std::function<void()>;
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<Queue> queues;
+  std::atomic<std::size_t> n_queued{};
+  std::atomic<std::size_t> next_queue{};
+
+  std::mutex sleep_mutex;
+  std::condition_variable_any wakeup;
+
+  // last member, workers must be joined before the queues are destroyed
+  std::vector<std::jthread> threads;
+
+  [[nodiscard]] std::optional<Task> pop_task(const std::size_t id) {
+    for (auto i{0UZ}; i < queues.size(); ++i) {
+      auto& q{queues[(id + i) % queues.size()]};
+      std::scoped_lock lock{q.mutex};
+      if (not q.tasks.empty()) {
+        Task task;
+        if (i == 0) {
+          task = std::move(q.tasks.back());
+          q.tasks.pop_back();
+        } else {
+          task = std::move(q.tasks.front());
+          q.tasks.pop_front();
+        }
+        n_queued -= 1;
+        return task;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void work(std::stop_token stop, const std::size_t id) {
+    while (not stop.stop_requested()) {
+      if (auto task{pop_task(id)}) {
+        (*task)();
+        continue;
+      }
+      std::unique_lock lock{sleep_mutex};
+      wakeup.wait(lock, stop, [this] { return n_queued > 0; });
+    }
+  }
+
+ public:
+  explicit ThreadPool(unsigned n_threads = std::max(1U, std::thread::hardware_concurrency()))
+      : queues(n_threads) {
+    for (auto id{0UZ}; id < n_threads; ++id) {
+      threads.emplace_back([this, id](std::stop_token stop) { work(stop, id); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  [[nodiscard]] std::size_t size() const noexcept {
+    return threads.size();
+  }
+
+  void submit(Task task) {
+    {
+      auto& q{queues[next_queue++ % queues.size()]};
+      std::scoped_lock lock{q.mutex};
+      q.tasks.push_back(std::move(task));
+      n_queued += 1;
+    }
+    {
+      // a worker that just saw an empty pool is either already waiting or will see n_queued > 0
+      std::scoped_lock lock{sleep_mutex};
+    }
+    wakeup.notify_one();
+  }
+
+  // Completion state of one group of submitted tasks.
+  // Tasks share ownership so that the last one can notify after the submitter has returned.
+  // Once a task has thrown the group is cancelled, and tasks should skip their remaining work.
+  struct Group {
+    std::atomic<std::size_t> pending;
+    std::atomic<bool> cancelled{};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    explicit Group(std::size_t n) : pending{n} {
+    }
+
+    void run(auto&& fn) {
+      try {
+        fn();
+      } catch (...) {
+        std::scoped_lock lock{error_mutex};
+        if (not error) {
+          error = std::current_exception();
+        }
+        cancelled = true;
+      }
+      if (--pending == 0) {
+        pending.notify_all();
+      }
+    }
+  };
+
+  // Run queued tasks on the calling thread until all tasks of the group are done
+  void wait(Group& group) {
+    for (auto n{group.pending.load()}; n > 0; n = group.pending.load()) {
+      if (auto task{pop_task(next_queue % queues.size())}) {
+        (*task)();
+      } else {
+        group.pending.wait(n);
+      }
+    }
+    if (group.error) {
+      std::rethrow_exception(group.error);
+    }
+  }
+
+  // Call fn(first, last) for consecutive blocks of at most block_size indexes in [begin, end).
+  // Blocks that have not started when stop is requested or a block has thrown are skipped.
+  template <typename Fn>
+  void parallel_for(
+      const std::size_t begin,
+      const std::size_t end,
+      const std::size_t block_size,
+      Fn&& fn,
+      std::stop_token stop = {}
+  ) {
+    if (begin >= end) {
+      return;
+    }
+
+    auto group{std::make_shared<Group>((end - begin + block_size - 1) / block_size)};
+    for (auto first{begin}; first < end; first += block_size) {
+      const auto last{std::min(end, first + block_size)};
+      submit([&fn, stop, group, first, last] {
+        group->run([&] {
+          if (not stop.stop_requested() and not group->cancelled) {
+            std::invoke(fn, first, last);
+          }
+        });
+      });
+    }
+    wait(*group);
+  }
+
+  // Smallest index in [begin, end) found by search(first, last), which returns the first match in
+  // one block of at most block_size indexes.
+  // Workers claim blocks in increasing order and stop claiming as soon as a match is known
+  // below the next unclaimed block, so at most one block per worker is scanned past the answer.
+  // If search throws, no more blocks are claimed and the exception is rethrown.
+  template <typename Search>
+  std::optional<std::size_t> parallel_find_first_block(
+      const std::size_t begin,
+      const std::size_t end,
+      const std::size_t block_size,
+      Search&& search
+  ) {
+    std::atomic<std::size_t> next_block{begin};
+    std::atomic<std::size_t> best{end};
+
+    const auto update_best{[&best](const std::size_t i) {
+      for (auto b{best.load()}; i < b and not best.compare_exchange_weak(b, i);) {
+      }
+    }};
+
+    auto group{std::make_shared<Group>(size())};
+    for (auto t{0UZ}; t < size(); ++t) {
+      submit([&, group] {
+        group->run([&] {
+          for (auto first{next_block.fetch_add(block_size)}; first < best and not group->cancelled;
+               first = next_block.fetch_add(block_size)) {
+            const auto last{first + std::min(block_size, end - first)};
+            if (std::optional<std::size_t> hit{std::invoke(search, first, last)}) {
+              update_best(hit.value());
+            }
+          }
+        });
+      });
+    }
+    wait(*group);
+
+    if (best < end) {
+      return best;
+    }
+    return std::nullopt;
+  }
+
+  // Smallest index i >= begin such that pred(i) holds
+  template <std::predicate<std::size_t> Pred>
+  std::optional<std::size_t> parallel_find_first(
+      const std::size_t begin,
+      Pred&& pred,
+      const std::size_t end = std::numeric_limits<std::size_t>::max(),
+      const std::size_t block_size = 1UZ << 10
+  ) {
+    return parallel_find_first_block(
+        begin,
+        end,
+        block_size,
+        [&pred](const std::size_t first, const std::size_t last) -> std::optional<std::size_t> {
+          for (auto i{first}; i < last; ++i) {
+            if (std::invoke(pred, i)) {
+              return i;
+            }
+          }
+          return std::nullopt;
+        }
+    );
+  }
+
+  // The n smallest indexes i in [begin, end) such that pred(i) holds, in increasing order.
+  // Fewer than n are returned only after all of [begin, end) has been scanned, so end is required.
+  // If pred throws, the scan stops and the exception is rethrown.
+  template <std::predicate<std::size_t> Pred>
+  std::vector<std::size_t> parallel_find_first_n(
+      const std::size_t begin,
+      const std::size_t end,
+      const std::size_t n,
+      Pred&& pred,
+      const std::size_t block_size = 1UZ << 10
+  ) {
+    if (n == 0) {
+      return {};
+    }
+
+    std::atomic<std::size_t> next_block{begin};
+    // largest index that can still be among the n smallest matches
+    std::atomic<std::size_t> threshold{end};
+    std::mutex hits_mutex;
+    std::vector<std::size_t> hits;
+
+    const auto add_hit{[&](const std::size_t i) {
+      std::scoped_lock lock{hits_mutex};
+      hits.insert(std::ranges::upper_bound(hits, i), i);
+      if (hits.size() > n) {
+        hits.pop_back();
+      }
+      if (hits.size() == n) {
+        threshold = hits.back();
+      }
+    }};
+
+    auto group{std::make_shared<Group>(size())};
+    for (auto t{0UZ}; t < size(); ++t) {
+      submit([&, group] {
+        group->run([&] {
+          for (auto first{next_block.fetch_add(block_size)};
+               first < threshold and not group->cancelled;
+               first = next_block.fetch_add(block_size)) {
+            const auto last{first + std::min(block_size, end - first)};
+            for (auto i{first}; i < last and i < threshold and not group->cancelled; ++i) {
+              if (std::invoke(pred, i)) {
+                add_hit(i);
+              }
+            }
+          }
+        });
+      });
+    }
+    wait(*group);
+
+    return hits;
+  }
+};
+
+// Shared by all solutions in the same process, inline so that this holds in the multicall binary
+inline ThreadPool& thread_pool() {
+  static ThreadPool pool;
+  return pool;
+}
+
+}  // namespace parallel
+
+#endif  // PARALLEL_HEADER_INCLUDED
@@ -0,0 +1,10 @@
+#ifndef PRECOMPILED_HEADER_INCLUDED
+#define PRECOMPILED_HEADER_INCLUDED
+
+// Headers included by almost every solution, compiled once and prepended to every solution with
+// make PCH=1.
+// The include guards make the solutions' own includes of these headers no-ops.
+#include "aoc.hpp"
+#include "std.hpp"
+
+#endif  // PRECOMPILED_HEADER_INCLUDED
@@ -0,0 +1,763 @@
+#ifndef REGVM_HEADER_INCLUDED
+#define REGVM_HEADER_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Register machine shared by assembunny (2016), duet (2017) and elf code (2018).
+// Each dialect is parsed into the same three-address instructions, which are compiled into
+// pre-resolved operand slots before execution.
+namespace regvm {
+
+using Int = long;
+
+enum class Op : unsigned char {
+  // c = a
+  set,
+  // c = a <op> b
+  add,
+  sub,
+  mul,
+  mod,
+  band,
+  bor,
+  eq,
+  gt,
+  // relative jump by b if a passes the test
+  jnz,
+  jgz,
+  // output a
+  snd,
+  // c = next input
+  rcv,
+  // toggle the instruction at relative offset a (assembunny)
+  tgl,
+  // compiled only
+  nop,
+  add_clear,
+  mul_add,
+  divisor_check,
+  divisor_sum,
+  div_loop,
+};
+
+struct Arg {
+  bool is_register{};
+  Int value{};
+
+  bool operator==(const Arg&) const = default;
+};
+
+struct Instruction {
+  Op op{};
+  Arg a{};
+  Arg b{};
+  Arg c{};
+
+  bool operator==(const Instruction&) const = default;
+};
+
+struct Program {
+  std::vector<Instruction> instructions;
+  std::size_t n_registers{};
+  // elf code binds the instruction pointer to a register
+  std::optional<std::size_t> ip_register;
+};
+
+enum class Status : unsigned char {
+  halted,
+  needs_input,
+  output_ready,
+  breakpoint,
+};
+
+struct Cycle {
+  std::size_t start{};
+  std::size_t length{};
+};
+
+// Brent's algorithm on the sequence x0, f(x0), f(f(x0)), ... with O(1) states in memory
+template <std::equality_comparable State, std::invocable<const State&> F>
+Cycle find_cycle(const State& x0, F&& f) {
+  auto power{1UZ};
+  auto length{1UZ};
+  State tortoise{x0};
+  State hare{std::invoke(f, x0)};
+  for (; tortoise != hare; ++length) {
+    if (power == length) {
+      tortoise = hare;
+      power *= 2;
+      length = 0;
+    }
+    hare = std::invoke(f, hare);
+  }
+
+  tortoise = x0;
+  hare = x0;
+  for (auto i{0UZ}; i < length; ++i) {
+    hare = std::invoke(f, hare);
+  }
+  auto start{0UZ};
+  for (; tortoise != hare; ++start) {
+    tortoise = std::invoke(f, tortoise);
+    hare = std::invoke(f, hare);
+  }
+  return {start, length};
+}
+
+namespace detail {
+
+[[nodiscard]] bool writes_c(const Op op) noexcept {
+  switch (op) {
+    case Op::set:
+    case Op::add:
+    case Op::sub:
+    case Op::mul:
+    case Op::mod:
+    case Op::band:
+    case Op::bor:
+    case Op::eq:
+    case Op::gt:
+    case Op::rcv:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// reg += delta, in either add or sub form
+[[nodiscard]] std::optional<Int> increment_register(const Instruction& ins, const Int delta) {
+  if (ins.a.is_register and ins.c.is_register and ins.a.value == ins.c.value
+      and not ins.b.is_register
+      and ((ins.op == Op::add and ins.b.value == delta)
+           or (ins.op == Op::sub and ins.b.value == -delta))) {
+    return ins.c.value;
+  }
+  return std::nullopt;
+}
+
+[[nodiscard]] bool is_loop_back(const Instruction& ins, const Int reg, const Int offset) {
+  return ins.op == Op::jnz and ins.a.is_register and ins.a.value == reg
+         and not ins.b.is_register and ins.b.value == offset;
+}
+
+// inc x, dec y, jnz y -2 (in any order of the first two) is x += y, y = 0
+[[nodiscard]] std::optional<std::pair<Int, Int>> find_add_loop(
+    std::span<const Instruction> is,
+    const std::size_t i
+) {
+  if (i + 3 > is.size()) {
+    return std::nullopt;
+  }
+  for (const auto& [inc, dec] : {std::pair{i, i + 1}, std::pair{i + 1, i}}) {
+    const auto x{increment_register(is[inc], 1)};
+    const auto y{increment_register(is[dec], -1)};
+    if (x and y and *x != *y and is_loop_back(is[i + 2], *y, -2)) {
+      return std::pair{*x, *y};
+    }
+  }
+  return std::nullopt;
+}
+
+// dst = x <op> y or dst = y <op> x
+[[nodiscard]] bool is_commutative(
+    const Instruction& ins,
+    const Op op,
+    const Arg& x,
+    const Arg& y,
+    const Arg& dst
+) {
+  return ins.op == op and ins.c == dst
+         and ((ins.a == x and ins.b == y) or (ins.a == y and ins.b == x));
+}
+
+[[nodiscard]] bool are_distinct_registers(std::initializer_list<Arg> args) {
+  return std::ranges::all_of(args, [&args](const Arg& r) {
+    return r.is_register and std::ranges::count(args, r) == 1;
+  });
+}
+
+constexpr Arg reg(const Int r) {
+  return {true, r};
+}
+
+constexpr Arg imm(const Int v) {
+  return {false, v};
+}
+
+// Sum of the divisors of n that are at least lo
+[[nodiscard]] Int divisor_sum(const Int n, const Int lo) {
+  Int sum{};
+  for (Int k{1}; k * k <= n; ++k) {
+    if (n % k == 0) {
+      sum += k >= lo ? k : 0;
+      if (const auto q{n / k}; q != k and q >= lo) {
+        sum += q;
+      }
+    }
+  }
+  return sum;
+}
+
+}  // namespace detail
+
+// Assembunny tgl: inc becomes dec and every other single argument instruction becomes inc,
+// jnz becomes cpy and every other two argument instruction becomes jnz
+void toggle(Instruction& ins) {
+  if (detail::increment_register(ins, 1)) {
+    ins.b.value = -1;
+  } else if (detail::increment_register(ins, -1)) {
+    ins.b.value = 1;
+  } else if (ins.op == Op::tgl or ins.op == Op::snd) {
+    ins = {Op::add, ins.a, {.value = 1}, ins.a};
+  } else if (ins.op == Op::jnz) {
+    ins = {Op::set, ins.a, {}, ins.b};
+  } else if (ins.op == Op::set) {
+    ins = {Op::jnz, ins.a, ins.c};
+  } else {
+    throw std::runtime_error("cannot toggle non-assembunny instruction");
+  }
+}
+
+class Machine {
+  struct Code {
+    Op op{};
+    std::array<std::uint32_t, 5> args{};
+  };
+
+  Program program;
+
+  // registers, then the instruction pointer slot, then constants
+  // Capacity covers the constants of every compilation so registers never move.
+  std::vector<Int> values;
+  std::size_t ip_slot{};
+
+  std::vector<Code> code;
+  // non-fused code, for when the guard of a fused instruction does not hold
+  std::vector<Code> plain;
+  bool needs_compile{};
+
+  Int ip{};
+
+  std::uint32_t slot(const Arg& arg) {
+    if (arg.is_register) {
+      if (arg.value < 0 or std::cmp_greater_equal(arg.value, program.n_registers)) {
+        throw std::runtime_error(std::format("register {} does not exist", arg.value));
+      }
+      return static_cast<std::uint32_t>(arg.value);
+    }
+    values.push_back(arg.value);
+    return static_cast<std::uint32_t>(values.size() - 1);
+  }
+
+  Code compile_plain(const Instruction& ins) {
+    if (detail::writes_c(ins.op) and not ins.c.is_register) {
+      // assembunny skips toggled instructions that became invalid
+      return {Op::nop};
+    }
+    return {ins.op, {slot(ins.a), slot(ins.b), slot(ins.c)}};
+  }
+
+  // Counting loops of elf code, which jumps by writing to the instruction pointer register
+  std::optional<Code> compile_elf_loop(std::span<const Instruction> is, const std::size_t p) {
+    using detail::imm;
+    using detail::is_commutative;
+    using detail::reg;
+    if (not program.ip_register) {
+      return std::nullopt;
+    }
+    const auto ipr{reg(static_cast<Int>(*program.ip_register))};
+    // elf code jumps to the instruction after the written value
+    const auto jump_to_p{imm(static_cast<Int>(p) - 1)};
+    const auto at{[&is, p](std::size_t k) -> const Instruction& { return is[p + k]; }};
+
+    // for (j = 1; i <= n; ++i) with the divisor check below inside
+    const auto divisor_sum{[&]() -> std::optional<Code> {
+      if (p + 14 > is.size() or at(0).op != Op::set or at(0).a != imm(1)) {
+        return std::nullopt;
+      }
+      const auto& j{at(0).c};
+      const auto& i{at(10).a};
+      const auto& t{at(11).c};
+      const auto& n{at(11).b};
+      if (at(10) == Instruction{Op::add, i, imm(1), i}
+          and at(11) == Instruction{Op::gt, i, n, t}
+          and is_commutative(at(12), Op::add, t, ipr, ipr)
+          and at(13) == Instruction{Op::set, jump_to_p, {}, ipr}) {
+        const auto inner{compile_elf_loop(is, p + 1)};
+        if (inner and inner->op == Op::divisor_check) {
+          const auto is_slot{[](const Arg& r, const std::uint32_t k) {
+            return r.is_register and r.value == k;
+          }};
+          const auto [ii, jj, tt, nn, _]{inner->args};
+          if (is_slot(i, ii) and is_slot(j, jj) and is_slot(t, tt) and is_slot(n, nn)) {
+            return Code{Op::divisor_sum, inner->args};
+          }
+        }
+      }
+      return std::nullopt;
+    }};
+    if (auto code{divisor_sum()}) {
+      return code;
+    }
+
+    // for (;; ++j) { if (i * j == n) { s += i; } if (j + 1 > n) { break; } }
+    if (p + 9 <= is.size() and at(0).op == Op::mul and at(5).op == Op::add) {
+      const auto& j{at(5).c};
+      const auto& i{at(0).a == j ? at(0).b : at(0).a};
+      const auto& t{at(0).c};
+      const auto& n{at(1).a == t ? at(1).b : at(1).a};
+      const auto& s{at(4).c};
+      if (detail::are_distinct_registers({i, j, t, n, s, ipr})
+          and is_commutative(at(0), Op::mul, i, j, t)
+          and is_commutative(at(1), Op::eq, t, n, t)
+          and is_commutative(at(2), Op::add, t, ipr, ipr)
+          and at(3) == Instruction{Op::add, ipr, imm(1), ipr}
+          and is_commutative(at(4), Op::add, i, s, s)
+          and at(5) == Instruction{Op::add, j, imm(1), j}
+          and at(6) == Instruction{Op::gt, j, n, t}
+          and is_commutative(at(7), Op::add, t, ipr, ipr)
+          and at(8) == Instruction{Op::set, jump_to_p, {}, ipr}) {
+        return Code{Op::divisor_check, {slot(i), slot(j), slot(t), slot(n), slot(s)}};
+      }
+    }
+
+    // for (q = q; (q + 1) * d <= x; ++q) {}
+    if (p + 8 <= is.size() and at(0).op == Op::add and at(1).op == Op::mul) {
+      const auto& q{at(0).a};
+      const auto& t{at(0).c};
+      const auto& d{at(1).b};
+      const auto& x{at(2).b};
+      const auto& done{at(5).a};
+      if (detail::are_distinct_registers({q, t, x, ipr}) and not d.is_register
+          and not done.is_register
+          and at(0) == Instruction{Op::add, q, imm(1), t}
+          and at(1) == Instruction{Op::mul, t, d, t}
+          and at(2) == Instruction{Op::gt, t, x, t}
+          and is_commutative(at(3), Op::add, t, ipr, ipr)
+          and at(4) == Instruction{Op::add, ipr, imm(1), ipr}
+          and at(5) == Instruction{Op::set, done, {}, ipr}
+          and at(6) == Instruction{Op::add, q, imm(1), q}
+          and at(7) == Instruction{Op::set, jump_to_p, {}, ipr}) {
+        return Code{Op::div_loop, {slot(q), slot(t), slot(x), slot(d), slot(done)}};
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  Code compile_fused(std::span<const Instruction> is, const std::size_t i) {
+    if (auto code{compile_elf_loop(is, i)}) {
+      return *code;
+    }
+    using detail::find_add_loop;
+    using detail::increment_register;
+    using detail::is_loop_back;
+    // cpy b c, add loop c into a, dec d, jnz d -5 is a += b * d, c = 0, d = 0
+    if (i + 6 <= is.size() and is[i].op == Op::set and is[i].c.is_register) {
+      const auto& b{is[i].a};
+      const auto c{is[i].c.value};
+      const auto loop{find_add_loop(is, i + 1)};
+      const auto d{increment_register(is[i + 4], -1)};
+      if (loop and loop->second == c and d and is_loop_back(is[i + 5], *d, -5)) {
+        const auto a{loop->first};
+        const auto distinct{a != *d and c != *d};
+        const auto b_is_free{
+            not b.is_register or (b.value != a and b.value != c and b.value != *d)
+        };
+        if (distinct and b_is_free) {
+          return {
+              Op::mul_add,
+              {slot({true, a}), slot(b), slot({true, c}), slot({true, *d})},
+          };
+        }
+      }
+    }
+    if (const auto loop{find_add_loop(is, i)}) {
+      return {Op::add_clear, {slot({true, loop->first}), slot({true, loop->second})}};
+    }
+    return plain[i];
+  }
+
+  void compile() {
+    values.resize(program.n_registers + 1);
+    plain.clear();
+    for (const auto& ins : program.instructions) {
+      plain.push_back(compile_plain(ins));
+    }
+    code.clear();
+    for (auto i{0UZ}; i < program.instructions.size(); ++i) {
+      code.push_back(compile_fused(program.instructions, i));
+    }
+    needs_compile = false;
+  }
+
+  // false if blocked on empty input
+  bool execute(const Code& ins) {
+    auto& v{values};
+    const auto [a, b, c, d, e]{ins.args};
+    switch (ins.op) {
+      case Op::set: {
+        v[c] = v[a];
+      } break;
+      case Op::add: {
+        v[c] = v[a] + v[b];
+      } break;
+      case Op::sub: {
+        v[c] = v[a] - v[b];
+      } break;
+      case Op::mul: {
+        v[c] = v[a] * v[b];
+      } break;
+      case Op::mod: {
+        v[c] = v[a] % v[b];
+      } break;
+      case Op::band: {
+        v[c] = v[a] & v[b];
+      } break;
+      case Op::bor: {
+        v[c] = v[a] | v[b];
+      } break;
+      case Op::eq: {
+        v[c] = Int{v[a] == v[b]};
+      } break;
+      case Op::gt: {
+        v[c] = Int{v[a] > v[b]};
+      } break;
+      case Op::jnz: {
+        if (v[a] != 0) {
+          v[ip_slot] += v[b] - 1;
+        }
+      } break;
+      case Op::jgz: {
+        if (v[a] > 0) {
+          v[ip_slot] += v[b] - 1;
+        }
+      } break;
+      case Op::snd: {
+        output.push_back(v[a]);
+      } break;
+      case Op::rcv: {
+        if (input.empty()) {
+          return false;
+        }
+        v[c] = input.front();
+        input.pop_front();
+      } break;
+      case Op::tgl: {
+        const auto target{v[ip_slot] + v[a]};
+        if (0 <= target and target < std::ssize(program.instructions)) {
+          toggle(program.instructions[target]);
+          needs_compile = true;
+        }
+      } break;
+      case Op::nop: {
+      } break;
+      case Op::add_clear: {
+        if (v[b] <= 0) {
+          return execute(plain[v[ip_slot]]);
+        }
+        v[a] += v[b];
+        v[b] = 0;
+        v[ip_slot] += 2;
+      } break;
+      case Op::mul_add: {
+        if (v[b] <= 0 or v[d] <= 0) {
+          return execute(plain[v[ip_slot]]);
+        }
+        v[a] += v[b] * v[d];
+        v[c] = 0;
+        v[d] = 0;
+        v[ip_slot] += 5;
+      } break;
+      case Op::divisor_check: {
+        // a: i, b: j, c: t, d: n, e: s
+        if (v[a] <= 0 or v[b] <= 0 or v[d] <= 0) {
+          return execute(plain[v[ip_slot]]);
+        }
+        if (v[d] % v[a] == 0 and v[d] / v[a] >= v[b]) {
+          v[e] += v[a];
+        }
+        v[b] = std::max(v[b], v[d]) + 1;
+        v[c] = 1;
+        v[ip_slot] += 8;
+      } break;
+      case Op::divisor_sum: {
+        if (v[a] <= 0 or v[d] <= 0) {
+          return execute(plain[v[ip_slot]]);
+        }
+        v[e] += detail::divisor_sum(v[d], v[a]);
+        v[a] = std::max(v[a], v[d]) + 1;
+        v[b] = v[d] + 1;
+        v[c] = 1;
+        v[ip_slot] += 13;
+      } break;
+      case Op::div_loop: {
+        // a: q, b: t, c: x, d: divisor, e: exit
+        if (v[a] < 0 or v[c] < 0 or v[d] <= 0) {
+          return execute(plain[v[ip_slot]]);
+        }
+        v[a] = std::max(v[a], v[c] / v[d]);
+        v[b] = 1;
+        v[ip_slot] = v[e];
+      } break;
+    }
+    return true;
+  }
+
+  template <bool until_output>
+  Status run_impl(const Int breakpoint) {
+    for (bool first{true};; first = false) {
+      if (needs_compile) {
+        compile();
+      }
+      if (ip < 0 or ip >= std::ssize(code)) {
+        return Status::halted;
+      }
+      if (ip == breakpoint and not first) {
+        return Status::breakpoint;
+      }
+      values[ip_slot] = ip;
+      const auto n_output{output.size()};
+      if (not execute(code[ip])) {
+        return Status::needs_input;
+      }
+      ip = values[ip_slot] + 1;
+      if (until_output and output.size() > n_output) {
+        return Status::output_ready;
+      }
+    }
+  }
+
+ public:
+  std::deque<Int> input, output;
+
+  explicit Machine(Program p)
+      : program(std::move(p)),
+        values(program.n_registers + 1),
+        ip_slot(program.ip_register.value_or(program.n_registers)) {
+    // at most 3 constants per plain instruction and 2 per fused instruction
+    values.reserve(values.size() + 5 * program.instructions.size());
+    compile();
+  }
+
+  [[nodiscard]] std::span<Int> registers() noexcept {
+    return std::span(values).first(program.n_registers);
+  }
+
+  [[nodiscard]] Int& reg(const std::size_t i) {
+    return registers()[i];
+  }
+
+  [[nodiscard]] Int& instruction_pointer() noexcept {
+    return ip;
+  }
+
+  // Run until halted or blocked on input.
+  // If breakpoint is reached after at least one instruction, stop before executing it.
+  Status run(const Int breakpoint = -1) {
+    return run_impl<false>(breakpoint);
+  }
+
+  Status run_until_output() {
+    return run_impl<true>(-1);
+  }
+};
+
+namespace detail {
+
+using Name = std::pair<std::string_view, Op>;
+
+constexpr std::array duet_binops{
+    Name{"add", Op::add},
+    Name{"sub", Op::sub},
+    Name{"mul", Op::mul},
+    Name{"mod", Op::mod},
+};
+constexpr std::array elf_binops{
+    Name{"add", Op::add},
+    Name{"mul", Op::mul},
+    Name{"ban", Op::band},
+    Name{"bor", Op::bor},
+};
+constexpr std::array elf_comparisons{
+    Name{"gt", Op::gt},
+    Name{"eq", Op::eq},
+};
+
+Arg parse_arg(const std::string& s, const char last_register) {
+  if (s.size() == 1 and 'a' <= s.front() and s.front() <= last_register) {
+    return {true, s.front() - 'a'};
+  }
+  return {false, std::stol(s)};
+}
+
+template <typename ParseLine>
+std::vector<Instruction> parse_lines(std::istream& is, ParseLine&& parse_line) {
+  std::vector<Instruction> instructions;
+  for (std::string line; std::getline(is, line);) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream ls{line};
+    std::string name;
+    ls >> name;
+    if (std::optional<Instruction> ins{parse_line(name, ls)}; ins and (ls >> std::ws).eof()) {
+      instructions.push_back(*ins);
+    } else {
+      throw std::runtime_error(std::format("failed parsing line '{}'", line));
+    }
+  }
+  return instructions;
+}
+
+}  // namespace detail
+
+// cpy, inc, dec, jnz, tgl and out with registers a to d
+Program parse_assembunny(const std::string& input) {
+  std::istringstream is{input};
+  auto instructions{detail::parse_lines(
+      is,
+      [](const std::string& name, std::istream& ls) -> std::optional<Instruction> {
+        const auto arg{[&ls] {
+          std::string s;
+          ls >> s;
+          return detail::parse_arg(s, 'd');
+        }};
+        if (name == "cpy") {
+          const auto src{arg()};
+          return Instruction{Op::set, src, {}, arg()};
+        }
+        if (name == "inc" or name == "dec") {
+          const auto dst{arg()};
+          return Instruction{Op::add, dst, {.value = name == "inc" ? 1 : -1}, dst};
+        }
+        if (name == "jnz") {
+          const auto test{arg()};
+          return Instruction{Op::jnz, test, arg()};
+        }
+        if (name == "tgl") {
+          return Instruction{Op::tgl, arg()};
+        }
+        if (name == "out") {
+          return Instruction{Op::snd, arg()};
+        }
+        return std::nullopt;
+      }
+  )};
+  return {std::move(instructions), 4};
+}
+
+// set, add, sub, mul, mod, jnz, jgz, snd and rcv with registers a to z
+Program parse_duet(const std::string& input) {
+  std::istringstream is{input};
+  auto instructions{detail::parse_lines(
+      is,
+      [](const std::string& name, std::istream& ls) -> std::optional<Instruction> {
+        const auto arg{[&ls] {
+          std::string s;
+          ls >> s;
+          return detail::parse_arg(s, 'z');
+        }};
+        if (name == "snd") {
+          return Instruction{Op::snd, arg()};
+        }
+        if (name == "rcv") {
+          return Instruction{Op::rcv, {}, {}, arg()};
+        }
+        const auto x{arg()};
+        const auto y{arg()};
+        if (name == "set") {
+          return Instruction{Op::set, y, {}, x};
+        }
+        if (name == "jnz" or name == "jgz") {
+          return Instruction{name == "jnz" ? Op::jnz : Op::jgz, x, y};
+        }
+        for (const auto& [s, op] : detail::duet_binops) {
+          if (name == s) {
+            return Instruction{op, x, y, x};
+          }
+        }
+        return std::nullopt;
+      }
+  )};
+  return {std::move(instructions), 26};
+}
+
+// One elf code instruction, e.g. elf_instruction("gtir", 3, 1, 2)
+std::optional<Instruction> elf_instruction(
+    const std::string_view name,
+    const Int a,
+    const Int b,
+    const Int c
+) {
+  if (name.size() != 4) {
+    return std::nullopt;
+  }
+  const Arg reg_a{true, a}, imm_a{false, a};
+  const Arg reg_b{true, b}, imm_b{false, b};
+  const Arg dst{true, c};
+  const auto mode{name.back()};
+  const auto stem{name.substr(0, 3)};
+  if (stem == "set" and (mode == 'r' or mode == 'i')) {
+    return Instruction{Op::set, mode == 'r' ? reg_a : imm_a, {}, dst};
+  }
+  for (const auto& [s, op] : detail::elf_binops) {
+    if (stem == s and (mode == 'r' or mode == 'i')) {
+      return Instruction{op, reg_a, mode == 'r' ? reg_b : imm_b, dst};
+    }
+  }
+  for (const auto& [s, op] : detail::elf_comparisons) {
+    if (name.starts_with(s)) {
+      const auto modes{name.substr(2)};
+      if (modes == "ir") {
+        return Instruction{op, imm_a, reg_b, dst};
+      }
+      if (modes == "ri") {
+        return Instruction{op, reg_a, imm_b, dst};
+      }
+      if (modes == "rr") {
+        return Instruction{op, reg_a, reg_b, dst};
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+// #ip declaration followed by elf code instructions with registers 0 to 5
+Program parse_elf(const std::string& input) {
+  std::istringstream is{input};
+  std::string decl;
+  if (std::size_t ipr{}; is >> decl >> ipr and decl == "#ip") {
+    auto instructions{detail::parse_lines(
+        is,
+        [](const std::string& name, std::istream& ls) -> std::optional<Instruction> {
+          if (Int a{}, b{}, c{}; ls >> a >> b >> c) {
+            return elf_instruction(name, a, b, c);
+          }
+          return std::nullopt;
+        }
+    )};
+    return {std::move(instructions), 6, ipr};
+  }
+  throw std::runtime_error("input is not elf code (aoc year 2018)");
+}
+
+}  // namespace regvm
+
+#endif  // REGVM_HEADER_INCLUDED
@@ -23,6 +23,7 @@
 #include <ranges>
 #include <regex>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <system_error>
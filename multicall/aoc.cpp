@@ -0,0 +1,120 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "std.hpp"
+
+// Entry points of all solutions, generated by make multicall.
+// Each is the main of one solution object, renamed by scripts/multicall_object.bash.
+#define AOC_SOLUTION(name, entry) extern "C" int entry();
+#include "solutions.inc"
+#undef AOC_SOLUTION
+
+struct Solution {
+  std::string_view name;
+  int (*main)();
+};
+
+constexpr std::array solutions{
+#define AOC_SOLUTION(name, entry) Solution{name, entry},
+#include "solutions.inc"
+#undef AOC_SOLUTION
+};
+
+const Solution& find_solution(std::string_view name) {
+  if (const auto it{std::ranges::find(solutions, name, &Solution::name)}; it != solutions.end()) {
+    return *it;
+  }
+  throw std::runtime_error(std::format("unknown solution '{}'", name));
+}
+
+// Solutions read /dev/stdin or std::cin, so replacing file descriptor 0 gives each one its input
+void redirect_stdin(const std::filesystem::path& path) {
+  std::cin.sync();
+  std::fflush(stdin);
+  const int fd{::open(path.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    throw std::runtime_error("cannot open input file " + path.string());
+  }
+  const int status{::dup2(fd, STDIN_FILENO)};
+  ::close(fd);
+  if (status < 0) {
+    throw std::runtime_error("cannot redirect stdin to " + path.string());
+  }
+  std::clearerr(stdin);
+  std::cin.clear();
+}
+
+int run(const Solution& solution) {
+  const int status{solution.main()};
+  std::cout.flush();
+  std::fflush(stdout);
+  return status;
+}
+
+// Run every solution that has an input file in input_dir, one after the other
+int run_all(const std::filesystem::path& input_dir) {
+  using Clock = std::chrono::steady_clock;
+  using Seconds = std::chrono::duration<double>;
+
+  Clock::duration total{};
+  auto n_run{0};
+  auto n_failed{0};
+  for (const auto& solution : solutions) {
+    const auto input{input_dir / solution.name};
+    if (not std::filesystem::exists(input)) {
+      continue;
+    }
+    std::println("{}", solution.name);
+    std::fflush(stdout);
+    redirect_stdin(input);
+
+    const auto begin{Clock::now()};
+    auto status{0};
+    try {
+      status = run(solution);
+    } catch (const std::exception& e) {
+      std::println(stderr, "{}: {}", solution.name, e.what());
+      status = 1;
+    }
+    const auto elapsed{Clock::now() - begin};
+
+    total += elapsed;
+    n_run += 1;
+    n_failed += status != 0;
+    std::println(stderr, "{} {:.3f} s", solution.name, Seconds(elapsed).count());
+  }
+  std::println(
+      stderr, "{} solutions in {:.3f} s, {} failed", n_run, Seconds(total).count(), n_failed
+  );
+  return n_failed == 0 ? 0 : 1;
+}
+
+int usage(std::string_view program) {
+  std::println(stderr, "usage: {} list", program);
+  std::println(stderr, "       {} run YEAR/DAY < input", program);
+  std::println(stderr, "       {} run --all [input_dir]", program);
+  return 2;
+}
+
+int main(int argc, char* argv[]) {
+  std::ios::sync_with_stdio(false);
+
+  const std::vector<std::string_view> args(argv, argv + argc);
+
+  if (args.size() == 2 and args[1] == "list") {
+    for (const auto& solution : solutions) {
+      std::println("{}", solution.name);
+    }
+    return 0;
+  }
+  if (args.size() >= 3 and args.size() <= 4 and args[1] == "run" and args[2] == "--all") {
+    return run_all(args.size() == 4 ? args[3] : "txt/input");
+  }
+  if (args.size() == 3 and args[1] == "run") {
+    return run(find_solution(args[2]));
+  }
+  return usage(args[0]);
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+set -ueo pipefail
+
+# run each solution several times against its input and write one CSV row of timings per solution
+
+function error {
+  printf "$@\n" >> /dev/stderr
+}
+
+if [ $# -lt 4 ]; then
+  error "usage: $0 out_dir n_runs report solution..."
+  error "example: $0 out/fast 5 bench.csv 2019/23 2020/15"
+  exit 2
+fi
+
+out_dir="$1"
+n_runs="$2"
+report="$3"
+shift 3
+
+tmpdir="$(mktemp --directory)"
+function rm_tmpdir {
+  rm -rf "$tmpdir"
+}
+trap rm_tmpdir EXIT
+
+# prints 'wall_s user_s sys_s max_rss_kb' for one run and returns the exit status of the solution
+function time_once {
+  local solution="$1"
+  local input="$2"
+  local log="${tmpdir}/time.log"
+  local status=0
+  if [ "$(uname)" = 'Darwin' ]; then
+    /usr/bin/time -l -o "$log" "$solution" < "$input" > "${tmpdir}/result" || status=$?
+    awk '
+      /real/ { wall = $1; user = $3; sys = $5 }
+      /maximum resident set size/ { rss = int($1 / 1024) }
+      END { print wall, user, sys, rss }
+    ' "$log"
+  else
+    /usr/bin/time -f '%e %U %S %M' -o "$log" "$solution" < "$input" > "${tmpdir}/result" \
+      || status=$?
+    tail -n 1 "$log"
+  fi
+  return "$status"
+}
+
+function median {
+  sort -g | awk '{ v[NR] = $1 } END { print (NR % 2 ? v[(NR + 1) / 2] : (v[NR / 2] + v[NR / 2 + 1]) / 2) }'
+}
+
+printf 'solution,runs,correct,wall_min_s,wall_median_s,cpu_median_s,max_rss_kb\n' > "$report"
+
+for sol in "$@"; do
+  input="txt/input/${sol}"
+  correct="txt/correct/${sol}"
+  if [ ! -f "$input" ]; then
+    error "skipping ${sol}, no input"
+    continue
+  fi
+  runs="${tmpdir}/runs"
+  : > "$runs"
+  ok=yes
+  for _ in $(seq 1 "$n_runs"); do
+    # a failed or crashed run is reported as incorrect instead of ending the benchmark
+    if ! time_once "${out_dir}/${sol}" "$input" >> "$runs"; then
+      error "${sol} failed"
+      ok=no
+    elif [ -f "$correct" ] && ! cmp -s "${tmpdir}/result" "$correct"; then
+      ok=no
+    fi
+  done
+  wall_min=$(cut -d' ' -f1 "$runs" | sort -g | head -n 1)
+  wall_median=$(cut -d' ' -f1 "$runs" | median)
+  cpu_median=$(awk '{ print $2 + $3 }' "$runs" | median)
+  max_rss=$(cut -d' ' -f4 "$runs" | sort -g | tail -n 1)
+  printf '%s,%d,%s,%s,%s,%s,%s\n' \
+    "$sol" "$n_runs" "$ok" "$wall_min" "$wall_median" "$cpu_median" "$max_rss" \
+    | tee -a "$report"
+done
@@ -0,0 +1,48 @@
+#!/usr/bin/env bash
+set -ueo pipefail
+
+# compare two reports written by bench.bash and list solutions whose median wall time or peak
+# memory grew by more than the threshold percentage
+
+function error {
+  printf "$@\n" >> /dev/stderr
+}
+
+if [ $# -ne 2 -a $# -ne 3 ]; then
+  error "usage: $0 baseline.csv current.csv [threshold_percent]"
+  error "example: $0 out/fast/bench-old.csv out/fast/bench.csv 10"
+  exit 2
+fi
+
+baseline="$1"
+current="$2"
+threshold="${3:-10}"
+
+# timings below this many seconds are noise
+min_wall_s=0.01
+
+awk -F, -v threshold="$threshold" -v min_wall="$min_wall_s" '
+  FNR == 1 { next }
+  NR == FNR { wall[$1] = $5; rss[$1] = $7; next }
+  !($1 in wall) { printf "%-8s new\n", $1; next }
+  {
+    limit = 1 + threshold / 100
+    slower = $5 > min_wall && $5 > wall[$1] * limit
+    bigger = $7 > rss[$1] * limit
+    if ($3 != "yes") {
+      printf "%-8s incorrect result\n", $1
+      n_bad += 1
+    }
+    if (slower || bigger) {
+      printf "%-8s wall %ss -> %ss, rss %skB -> %skB\n", $1, wall[$1], $5, rss[$1], $7
+      n_bad += 1
+    }
+  }
+  END {
+    if (n_bad > 0) {
+      printf "%d regressions\n", n_bad
+      exit 1
+    }
+    print "no regressions"
+  }
+' "$baseline" "$current"
@@ -0,0 +1,41 @@
+#!/usr/bin/env bash
+set -ueo pipefail
+
+# list the median wall time speedup of every solution between two reports written by bench.bash
+
+function error {
+  printf "$@\n" >> /dev/stderr
+}
+
+if [ $# -ne 2 ]; then
+  error "usage: $0 baseline.csv current.csv"
+  error "example: $0 out/fast/bench.csv out/fast-pgo/bench.csv"
+  exit 2
+fi
+
+baseline="$1"
+current="$2"
+
+# timings below this many seconds are noise and left out of the mean
+min_wall_s=0.01
+
+awk -F, -v min_wall="$min_wall_s" '
+  FNR == 1 { next }
+  NR == FNR { wall[$1] = $5; next }
+  !($1 in wall) { next }
+  {
+    speedup = $5 > 0 ? wall[$1] / $5 : 1
+    note = $3 == "yes" ? "" : " incorrect"
+    printf "%-8s %8.3fs -> %8.3fs %6.2fx%s\n", $1, wall[$1], $5, speedup, note
+    if (wall[$1] > min_wall && $5 > 0) {
+      log_sum += log(speedup)
+      n += 1
+    }
+  }
+  END {
+    if (n > 0) {
+      mean = exp(log_sum / n)
+      printf "geometric mean speedup %.2fx over %d solutions slower than %ss\n", mean, n, min_wall
+    }
+  }
+' "$baseline" "$current"
@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+set -ue -o pipefail
+
+if [ $# -ne 3 ]; then
+  printf "usage: $0 solution object output\n"
+  exit 2
+fi
+
+# Every solution is compiled on its own and defines main, helpers with the same names as in other
+# solutions, and its own copies of the non-inline functions of the shared headers.
+# Prefixing all symbols defined by the object makes it safe to link all of them into one binary,
+# main is renamed to aoc_main_<year>_<day> for the dispatcher.
+# Local symbols are renamed too, since they name the COMDAT groups of inline functions and the
+# linker would otherwise keep only one solution's copy of each group.
+# The process-wide singletons of the shared headers are inline functions, so their static locals
+# and guards are weak globals. They keep their names, so that all solutions use the one thread pool
+# and timing registry that the linker keeps. With AOC_TIMING the registry then sums the phases of
+# the same name over all solutions run by 'aoc run --all'.
+
+solution="$1"
+object="$2"
+output="$3"
+
+NM=${NM:-nm}
+OBJCOPY=${OBJCOPY:-objcopy}
+
+prefix="aoc_${solution//\//_}_"
+entry="aoc_main_${solution//\//_}"
+# mangled names of the singleton functions, which also appear in their static locals and guards
+shared='N8parallel11thread_poolEv|N3aoc6detail15timing_registryEv'
+
+syms="${output}.syms"
+trap 'rm -f "$syms"' EXIT
+
+# Mach-O symbols have a leading underscore
+"$NM" --defined-only --format=just-symbols "$object" \
+  | awk -v prefix="$prefix" -v entry="$entry" -v shared="$shared" '
+      $0 == "main" { print $0, entry; next }
+      $0 == "_main" { print $0, "_" entry; next }
+      $0 ~ shared { next }
+      { print $0, prefix $0 }
+    ' > "$syms"
+
+"$OBJCOPY" --redefine-syms="$syms" "$object" "$output"
@@ -0,0 +1,99 @@
+#!/usr/bin/env bash
+set -ueo pipefail
+
+# translate small intcode programs with src/tools/intcode2cpp, compile the generated run_native
+# and check that it produces the same outputs as the interpreter
+
+tmpdir="$(mktemp --directory)"
+function rm_tmpdir {
+  rm -rf "$tmpdir"
+}
+trap rm_tmpdir EXIT
+
+llvm_version=${LLVM_VERSION:-20}
+fast=${FAST:-0}
+if [ "$fast" = 1 ]; then
+  out_dir=out/fast
+else
+  out_dir=out/debug
+fi
+cxx="${CXX:-clang++-${llvm_version}}"
+cxxflags="${CXXFLAGS:--std=c++23 -stdlib=libc++ -Wall -Wpedantic -Werror -g -O2}"
+ldflags="${LDFLAGS:--lm -lc++}"
+
+make --silent LLVM_VERSION=${llvm_version} FAST=${fast} "${out_dir}/tools/intcode2cpp"
+
+# Feeds the inputs one at a time to the interpreter and to run_native, resuming both whenever they
+# need more input, then prints native_code_valid of the native machine
+cat > "${tmpdir}/main.inc" << 'EOF'
+int main(int argc, char** argv) {
+  using Int = intcode::IntCode::Int;
+  const auto program{intcode::parse_program(aoc::slurp_file(argv[1]))};
+  intcode::IntCode interpreted(program);
+  intcode::IntCode native(program);
+  auto expect{interpreted.run_until_blocked()};
+  auto status{run_native(native)};
+  for (int i{2}; i < argc; ++i) {
+    if (expect != intcode::Status::needs_input or status != intcode::Status::needs_input) {
+      throw std::runtime_error(std::format("input {} was not needed", argv[i]));
+    }
+    const Int value{std::stol(argv[i])};
+    interpreted.input.push_back(value);
+    native.input.push_back(value);
+    expect = interpreted.run_until_blocked();
+    status = run_native(native);
+  }
+  if (status != expect or native.output.size() != interpreted.output.size()) {
+    throw std::runtime_error("native code stopped at a different point than the interpreter");
+  }
+  while (const auto out{interpreted.pop_output()}) {
+    if (native.pop_output() != out) {
+      throw std::runtime_error("native code outputs differ from the interpreter");
+    }
+  }
+  std::cout << native.native_code_valid << '\n';
+  return 0;
+}
+EOF
+
+function test_program {
+  local name="$1"
+  local program="$2"
+  local expect_valid="$3"
+  shift 3
+  printf '%s\n' "$name"
+  printf '%s\n' "$program" > "${tmpdir}/program.txt"
+  {
+    printf '#include "aoc.hpp"\n#include "intcode.hpp"\n#include "std.hpp"\n'
+    "${out_dir}/tools/intcode2cpp" < "${tmpdir}/program.txt"
+    cat "${tmpdir}/main.inc"
+  } > "${tmpdir}/native.cpp"
+  # shellcheck disable=SC2086
+  $cxx $cxxflags -I./include -I./ndvec "${tmpdir}/native.cpp" -o "${tmpdir}/native" $ldflags
+  local valid
+  valid=$("${tmpdir}/native" "${tmpdir}/program.txt" "$@")
+  if [ "$valid" != "$expect_valid" ]; then
+    printf "native_code_valid is %s after '%s', not %s\n" "$valid" "$name" "$expect_valid"
+    return 1
+  fi
+  return 0
+}
+
+# read n, then output 2n, 2n - 2, ..., 2, and again for a second n
+test_program 'loop with input' \
+  '3,100,1002,100,2,101,4,101,1001,100,-1,100,1005,100,2,1105,1,0' 1 3 2
+
+# 104 is stored over the 99 at address 4, which then outputs 42 in the interpreter
+test_program 'store over next instruction' '1101,100,4,4,99,42,99' 0
+
+# a loop that stores 99 over the instruction at 0 it has already executed
+test_program 'overwrite an executed instruction' \
+  '4,20,1001,20,1,20,1008,20,3,21,1006,21,0,1101,99,0,0,1105,1,0,0,0' 0
+
+# jump to the address stored at 20, the code at 9 is not decoded and must run in the interpreter
+computed_jump='1101,9,0,20,106,0,20,99,99,104,42,99,0,0,0,0,0,0,0,0,0'
+test_program 'computed jump' "$computed_jump" 1
+if printf '%s\n' "$computed_jump" | "${out_dir}/tools/intcode2cpp" | grep -q '^case 9:'; then
+  printf 'the target of the computed jump was decoded\n'
+  exit 1
+fi
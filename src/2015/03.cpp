@@ -61,7 +61,9 @@ int count_visited_houses(const auto&... moves_list) {
 }
 
 int main() {
-  const auto all_moves{aoc::parse_items<Direction>("/dev/stdin")};
+  const auto all_moves{aoc::timed("parse", [] {
+    return aoc::parse_items<Direction>("/dev/stdin");
+  })};
 
   // TODO(llvm21?) P1899R3 std::views::stride
   const auto santa_moves{all_moves | my_std::views::stride(2) | ranges::to<Moves>()};
@@ -70,8 +72,10 @@ int main() {
       all_moves | views::drop(1) | my_std::views::stride(2) | ranges::to<Moves>()
   };
 
-  const auto part1{count_visited_houses(all_moves)};
-  const auto part2{count_visited_houses(santa_moves, robot_moves)};
+  const auto part1{aoc::timed("part1", [&] { return count_visited_houses(all_moves); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return count_visited_houses(santa_moves, robot_moves);
+  })};
 
   std::println("{} {}", part1, part2);
 
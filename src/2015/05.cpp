@@ -71,10 +71,10 @@ bool is_nice_part2(const std::string& s) {
 }
 
 int main() {
-  const auto lines{aoc::parse_items<std::string>("/dev/stdin")};
+  const auto lines{aoc::timed("parse", [] { return aoc::parse_items<std::string>("/dev/stdin"); })};
 
-  const auto part1{ranges::count_if(lines, is_nice_part1)};
-  const auto part2{ranges::count_if(lines, is_nice_part2)};
+  const auto part1{aoc::timed("part1", [&] { return ranges::count_if(lines, is_nice_part1); })};
+  const auto part2{aoc::timed("part2", [&] { return ranges::count_if(lines, is_nice_part2); })};
 
   std::println("{} {}", part1, part2);
 
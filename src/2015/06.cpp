@@ -67,9 +67,9 @@ std::istream& operator>>(std::istream& is, Region& r) {
 constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
 
 int main() {
-  const auto regions{aoc::parse_items<Region>("/dev/stdin")};
+  const auto regions{aoc::timed("parse", [] { return aoc::parse_items<Region>("/dev/stdin"); })};
 
-  const auto lights{simulate(regions)};
+  const auto lights{aoc::timed("part1 and part2", [&] { return simulate(regions); })};
   const auto part1{sum(lights | views::elements<0>)};
   const auto part2{sum(lights | views::elements<1>)};
 
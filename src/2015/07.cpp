@@ -108,18 +108,18 @@ std::istream& operator>>(std::istream& is, Statement& s) {
 }
 
 int main() {
-  const auto circuit{
-      aoc::parse_items<Statement>("/dev/stdin")
-      | views::transform([](const auto& stmt) { return std::tuple{stmt.dst, stmt}; })
-      | ranges::to<std::unordered_map<std::string, Statement>>()
-  };
+  const auto circuit{aoc::timed("parse", [] {
+    return aoc::parse_items<Statement>("/dev/stdin")
+           | views::transform([](const auto& stmt) { return std::tuple{stmt.dst, stmt}; })
+           | ranges::to<std::unordered_map<std::string, Statement>>();
+  })};
 
   auto circuit_part1{circuit};
-  const auto part1{compute_signal("a", circuit_part1)};
+  const auto part1{aoc::timed("part1", [&] { return compute_signal("a", circuit_part1); })};
 
   auto circuit_part2{circuit};
   circuit_part2["b"] = {std::format("{}", part1), "", "b", Statement::Assign};
-  const auto part2{compute_signal("a", circuit_part2)};
+  const auto part2{aoc::timed("part2", [&] { return compute_signal("a", circuit_part2); })};
 
   std::println("{} {}", part1, part2);
 
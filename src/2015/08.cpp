@@ -80,10 +80,12 @@ auto escape(const std::string& s) {
 constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
 
 int main() {
-  const auto lines{aoc::parse_items<std::string>("/dev/stdin")};
+  const auto lines{aoc::timed("parse", [] { return aoc::parse_items<std::string>("/dev/stdin"); })};
 
-  const auto part1{sum(lines | views::transform(count_bytes))};
-  const auto part2{sum(lines | views::transform(escape) | views::transform(count_bytes))};
+  const auto part1{aoc::timed("part1", [&] { return sum(lines | views::transform(count_bytes)); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return sum(lines | views::transform(escape) | views::transform(count_bytes));
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -69,8 +69,10 @@ std::istream& operator>>(std::istream& is, Edge& edge) {
 }
 
 int main() {
-  Graph g{aoc::parse_items<Edge>("/dev/stdin")};
-  const auto [part1, part2]{ranges::minmax(g.find_all_hamiltonian_path_lengths())};
+  Graph g{aoc::timed("parse", [] { return aoc::parse_items<Edge>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return ranges::minmax(g.find_all_hamiltonian_path_lengths());
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -17,21 +17,25 @@ auto look_and_say(const auto& digits) {
 }
 
 int main() {
-  auto digits{
-      aoc::parse_items<char>("/dev/stdin") | views::transform([](char ch) { return ch - '0'; })
-      | ranges::to<std::vector>()
-  };
+  auto digits{aoc::timed("parse", [] {
+    return aoc::parse_items<char>("/dev/stdin") | views::transform([](char ch) { return ch - '0'; })
+           | ranges::to<std::vector>();
+  })};
 
   int iteration{};
-  for (; iteration < 40; ++iteration) {
-    digits = look_and_say(digits);
-  }
-  const auto part1{digits.size()};
+  const auto part1{aoc::timed("part1", [&] {
+    for (; iteration < 40; ++iteration) {
+      digits = look_and_say(digits);
+    }
+    return digits.size();
+  })};
 
-  for (; iteration < 50; ++iteration) {
-    digits = look_and_say(digits);
-  }
-  const auto part2{digits.size()};
+  const auto part2{aoc::timed("part2", [&] {
+    for (; iteration < 50; ++iteration) {
+      digits = look_and_say(digits);
+    }
+    return digits.size();
+  })};
 
   std::println("{} {}", part1, part2);
 
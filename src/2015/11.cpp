@@ -59,13 +59,13 @@ std::string search(auto& password) {
 }
 
 int main() {
-  auto password{
-      aoc::parse_items<char>("/dev/stdin") | views::transform(char2digit)
-      | ranges::to<std::vector>()
-  };
+  auto password{aoc::timed("parse", [] {
+    return aoc::parse_items<char>("/dev/stdin") | views::transform(char2digit)
+           | ranges::to<std::vector>();
+  })};
 
-  const auto part1{search(password)};
-  const auto part2{search(password)};
+  const auto part1{aoc::timed("part1", [&] { return search(password); })};
+  const auto part2{aoc::timed("part2", [&] { return search(password); })};
 
   std::println("{} {}", part1, part2);
 
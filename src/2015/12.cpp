@@ -249,8 +249,8 @@ int main() {
   Object o;
   input >> o;
 
-  auto part1{sum(o)};
-  auto part2{sum(o, std::optional("red"))};
+  const auto part1{aoc::timed("part1", [&] { return sum(o); })};
+  const auto part2{aoc::timed("part2", [&] { return sum(o, std::optional("red")); })};
 
   std::println("{} {}", part1, part2);
 
@@ -75,11 +75,11 @@ auto maximize_happiness(const auto& pairs) {
 }
 
 int main() {
-  auto pairs{aoc::parse_items<Pair>("/dev/stdin")};
+  auto pairs{aoc::timed("parse", [] { return aoc::parse_items<Pair>("/dev/stdin"); })};
 
-  const auto part1{maximize_happiness(pairs)};
+  const auto part1{aoc::timed("part1", [&] { return maximize_happiness(pairs); })};
   pairs.emplace_back("Me", "Anyone", 0);
-  const auto part2{maximize_happiness(pairs)};
+  const auto part2{aoc::timed("part2", [&] { return maximize_happiness(pairs); })};
 
   std::println("{} {}", part1, part2);
 
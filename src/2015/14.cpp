@@ -61,10 +61,14 @@ std::istream& operator>>(std::istream& is, Reindeer& reindeer) {
 }
 
 int main() {
-  const auto herd{aoc::parse_items<Reindeer>("/dev/stdin")};
+  const auto herd{aoc::timed("parse", [] { return aoc::parse_items<Reindeer>("/dev/stdin"); })};
 
-  const auto part1{ranges::max(views::transform(run_race(herd), &ReindeerState::distance))};
-  const auto part2{ranges::max(views::transform(run_race(herd), &ReindeerState::points))};
+  const auto part1{aoc::timed("part1", [&] {
+    return ranges::max(views::transform(run_race(herd), &ReindeerState::distance));
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return ranges::max(views::transform(run_race(herd), &ReindeerState::points));
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -77,7 +77,9 @@ std::istream& operator>>(std::istream& is, Ingredient& ingredient) {
 }
 
 int main() {
-  const auto ingredients{aoc::parse_items<Ingredient>("/dev/stdin")};
+  const auto ingredients{aoc::timed("parse", [] {
+    return aoc::parse_items<Ingredient>("/dev/stdin");
+  })};
 
   std::vector<std::vector<int>> weights{ingredients.front().as_vector().size()};
   for (const auto& ingredient : ingredients) {
@@ -89,8 +91,10 @@ int main() {
   std::vector<int> init_spoons(ingredients.size());
   init_spoons.front() = 100;
 
-  const auto part1{find_optimal_cookie(weights, init_spoons)};
-  const auto part2{find_optimal_cookie(weights, init_spoons, {500})};
+  const auto part1{aoc::timed("part1", [&] { return find_optimal_cookie(weights, init_spoons); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return find_optimal_cookie(weights, init_spoons, {500});
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -51,7 +51,7 @@ std::istream& operator>>(std::istream& is, Aunt& aunt) {
 }
 
 int main() {
-  const auto aunts{aoc::parse_items<Aunt>("/dev/stdin")};
+  const auto aunts{aoc::timed("parse", [] { return aoc::parse_items<Aunt>("/dev/stdin"); })};
 
   const auto equal_compare{[](const auto&, int lhs, int rhs) { return lhs == rhs; }};
   const auto fancy_compare{[](const auto& key, int lhs, int rhs) {
@@ -64,8 +64,8 @@ int main() {
     return lhs == rhs;
   }};
 
-  const auto aunt1{find_target_aunt(aunts, equal_compare)};
-  const auto aunt2{find_target_aunt(aunts, fancy_compare)};
+  const auto aunt1{aoc::timed("part1", [&] { return find_target_aunt(aunts, equal_compare); })};
+  const auto aunt2{aoc::timed("part2", [&] { return find_target_aunt(aunts, fancy_compare); })};
 
   std::println("{} {}", aunt1.id, aunt2.id);
 
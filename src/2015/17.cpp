@@ -29,8 +29,10 @@ auto find_all_combinations(const int init_target, const std::vector<int>& all_co
 }
 
 int main() {
-  const auto containers{aoc::parse_items<int>("/dev/stdin")};
-  const auto combinations{find_all_combinations(150, containers)};
+  const auto containers{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
+  const auto combinations{aoc::timed("part1 and part2", [&] {
+    return find_all_combinations(150, containers);
+  })};
 
   const auto part1{combinations.size()};
 
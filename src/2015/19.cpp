@@ -105,16 +105,20 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [replacements, medicine]{parse_input("/dev/stdin")};
+  const auto [replacements, medicine]{aoc::timed("parse", [] {
+    return parse_input("/dev/stdin");
+  })};
 
-  const auto part1{replace_all(medicine, replacements).size()};
+  const auto part1{aoc::timed("part1", [&] { return replace_all(medicine, replacements).size(); })};
 
   auto reverse_replacements{
       views::transform(replacements, [](const auto& r) { return Replacement{r.dst, r.src}; })
       | ranges::to<std::vector>()
   };
   ranges::sort(reverse_replacements, ranges::greater{}, [](const auto& r) { return r.src.size(); });
-  const auto part2{count_shortest_path_to(medicine, reverse_replacements, {"e"s})};
+  const auto part2{aoc::timed("part2", [&] {
+    return count_shortest_path_to(medicine, reverse_replacements, {"e"s});
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -20,8 +20,8 @@ auto deliver_presents(
 
 int main() {
   if (int target{}; std::cin >> target) {
-    const auto part1{deliver_presents(target, 10)};
-    const auto part2{deliver_presents(target, 11, 50)};
+    const auto part1{aoc::timed("part1", [&] { return deliver_presents(target, 10); })};
+    const auto part2{aoc::timed("part2", [&] { return deliver_presents(target, 11, 50); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
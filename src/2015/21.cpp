@@ -107,7 +107,7 @@ auto minmax_gold(const Boss& boss) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (Boss boss; std::cin >> boss) {
-    const auto [part1, part2] = minmax_gold(boss);
+    const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return minmax_gold(boss); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
@@ -122,8 +122,8 @@ int main() {
   std::istringstream is{aoc::slurp_file("/dev/stdin")};
   if (Unit boss{}; is >> std::ws >> skip("Hit"s, "Points:"s) >> boss.hp >> std::ws
                    >> skip("Damage:"s) >> boss.damage) {
-    const auto part1{find_min_win_mana(boss)};
-    const auto part2{find_min_win_mana(boss, 1)};
+    const auto part1{aoc::timed("part1", [&] { return find_min_win_mana(boss); })};
+    const auto part2{aoc::timed("part2", [&] { return find_min_win_mana(boss, 1); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
@@ -96,18 +96,24 @@ std::istream& operator>>(std::istream& is, Instruction& ins) {
 }
 
 int main() {
-  const auto program{aoc::parse_items<Instruction>("/dev/stdin")};
+  const auto program{aoc::timed("parse", [] {
+    return aoc::parse_items<Instruction>("/dev/stdin");
+  })};
 
   Memory memory;
   memory.fill(0);
 
-  run(memory, program);
-  const auto part1{memory[1]};
+  const auto part1{aoc::timed("part1", [&] {
+    run(memory, program);
+    return memory[1];
+  })};
 
   memory.fill(0);
   memory[0] = 1;
-  run(memory, program);
-  const auto part2{memory[1]};
+  const auto part2{aoc::timed("part2", [&] {
+    run(memory, program);
+    return memory[1];
+  })};
 
   std::println("{} {}", part1, part2);
 
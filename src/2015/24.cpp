@@ -41,10 +41,10 @@ long optimize_qe(const Ints& packages, const int group_count) {
 }
 
 int main() {
-  const auto packages{aoc::parse_items<int>("/dev/stdin")};
+  const auto packages{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
 
-  const auto part1{optimize_qe(packages, 3)};
-  const auto part2{optimize_qe(packages, 4)};
+  const auto part1{aoc::timed("part1", [&] { return optimize_qe(packages, 3); })};
+  const auto part2{aoc::timed("part2", [&] { return optimize_qe(packages, 4); })};
 
   std::println("{} {}", part1, part2);
 
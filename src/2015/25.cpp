@@ -29,7 +29,7 @@ int main() {
       is
       >> skip("To continue, please consult the code grid in the manual."s, "Enter the code at row"s)
       >> row >> skip(", column"s) >> col) {
-    const auto part1{find(row, col)};
+    const auto part1{aoc::timed("part1", [&] { return find(row, col); })};
     std::println("{}", part1);
     return 0;
   }
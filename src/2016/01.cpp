@@ -62,11 +62,11 @@ std::istream& operator>>(std::istream& is, Move& move) {
 }
 
 int main() {
-  const auto moves{aoc::parse_items<Move>("/dev/stdin")};
+  const auto moves{aoc::timed("parse", [] { return aoc::parse_items<Move>("/dev/stdin"); })};
   const auto path{walk(moves)};
 
-  const auto part1{find_part1(path)};
-  const auto part2{find_part2(path)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(path); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(path); })};
 
   std::println("{} {}", part1, part2);
 
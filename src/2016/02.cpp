@@ -70,7 +70,7 @@ auto parse_instructions(std::string_view path) {
 }
 
 int main() {
-  const auto instructions{parse_instructions("/dev/stdin")};
+  const auto instructions{aoc::timed("parse", [] { return parse_instructions("/dev/stdin"); })};
 
   const Keypad keypad1{
       .rows = {
@@ -81,7 +81,7 @@ int main() {
           "     "s,
       }
   };
-  const auto part1{find_code(keypad1, instructions)};
+  const auto part1{aoc::timed("part1", [&] { return find_code(keypad1, instructions); })};
 
   const Keypad keypad2{
       .rows = {
@@ -94,7 +94,7 @@ int main() {
           "       "s,
       }
   };
-  const auto part2{find_code(keypad2, instructions)};
+  const auto part2{aoc::timed("part2", [&] { return find_code(keypad2, instructions); })};
 
   std::println("{} {}", part1, part2);
 
@@ -33,13 +33,13 @@ int count_triangles_col_order(const Ints& input) {
 }
 
 int main() {
-  const auto ints{aoc::parse_items<int>("/dev/stdin")};
+  const auto ints{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
   if (ints.size() % 3 != 0U) {
     throw std::runtime_error("input must be divisible by 3");
   }
 
-  const auto part1{count_triangles_row_order(ints)};
-  const auto part2{count_triangles_col_order(ints)};
+  const auto part1{aoc::timed("part1", [&] { return count_triangles_row_order(ints); })};
+  const auto part2{aoc::timed("part2", [&] { return count_triangles_col_order(ints); })};
 
   std::println("{} {}", part1, part2);
 
@@ -84,10 +84,10 @@ std::istream& operator>>(std::istream& is, Room& room) {
 }
 
 int main() {
-  const auto rooms{aoc::parse_items<Room>("/dev/stdin")};
+  const auto rooms{aoc::timed("parse", [] { return aoc::parse_items<Room>("/dev/stdin"); })};
 
-  const auto part1{find_part1(rooms)};
-  const auto part2{find_part2(rooms)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(rooms); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(rooms); })};
 
   std::println("{} {}", part1, part2);
 
@@ -1,6 +1,7 @@
 #include "aoc.hpp"
 #include "md5.hpp"
 #include "my_std.hpp"
+#include "parallel.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
@@ -20,68 +21,47 @@ struct Result {
   }
 };
 
-struct ThreadPool {
-  static constexpr auto chunk_size{1UL << 18};
-  std::vector<std::thread> threads;
-  std::vector<Result> results;
+Result parallel_find_passwords(std::string_view msg) {
+  constexpr std::size_t max_iterations{100'000'000};
+  constexpr std::size_t block_size{1UZ << 12};
 
-  explicit ThreadPool(unsigned n_threads) : threads(n_threads), results(n_threads) {
-  }
+  constexpr auto is_match{[](md5::Chunk sum) { return (sum & 0xfffff000) == 0U; }};
 
-  void join() {
-    ranges::for_each(threads, [](auto& t) { t.join(); });
-  }
+  const md5::PrefixHasher hasher{msg};
 
-  void find_passwords(std::string_view msg, const int chunk_id, const int thread_id) {
-    Result res;
-    const auto offset{thread_id * chunk_size};
-    const auto begin{chunk_id + offset};
-    for (auto i{begin}; i < begin + chunk_size and not res.is_complete(); ++i) {
-      const auto sum{md5::sum32bit(std::format("{}{:d}", msg, i))};
-      if ((sum & 0xfffff000) != 0U) {
-        continue;
-      }
-      const auto pw_idx{(sum >> 8) & 0xf};
-      if (res.pw1.size() < Result::password_len) {
-        res.pw1 += std::format("{:x}", pw_idx);
-      }
-      if (pw_idx < Result::password_len and res.pw2[pw_idx] == 0) {
-        const auto pw_str{std::format("{:x}", (sum >> 4) & 0xf)};
-        res.pw2[pw_idx] = pw_str.front();
+  const auto search_block{
+      [&](std::size_t first, std::size_t last) -> std::optional<std::size_t> {
+        for (auto i{first}; i < last; i += md5::lanes) {
+          for (auto&& [lane, sum] : my_std::views::enumerate(hasher.sum32bit_batch(i))) {
+            if (i + lane < last and is_match(sum)) {
+              return i + lane;
+            }
+          }
+        }
+        return std::nullopt;
       }
-    }
-    results.at(thread_id) = res;
-  }
-};
+  };
 
-Result parallel_find_passwords(std::string_view msg) {
-  constexpr int max_iterations{100'000'000};
-  ThreadPool pool(std::max(1U, std::thread::hardware_concurrency()));
+  auto& pool{parallel::thread_pool()};
 
   Result res;
-  for (std::size_t i{}; i < max_iterations; i += ThreadPool::chunk_size * pool.results.size()) {
-    for (auto&& [t, th] : my_std::views::enumerate(pool.threads)) {
-      th = std::thread(&ThreadPool::find_passwords, &pool, msg, i, t);
+  for (std::size_t i{}; not res.is_complete(); ++i) {
+    if (auto hit{pool.parallel_find_first_block(i, max_iterations, block_size, search_block)}) {
+      i = hit.value();
+    } else {
+      throw std::runtime_error("search space exhausted, no answer");
     }
-    pool.join();
-    for (const Result& th_res : pool.results) {
-      for (auto ch : th_res.pw1) {
-        if (res.pw1.size() < Result::password_len) {
-          res.pw1.push_back(ch);
-        }
-      }
-      for (auto&& [pos, dst] : my_std::views::enumerate(res.pw2)) {
-        if (auto src{th_res.pw2[pos]}; src != 0 and dst == 0) {
-          dst = src;
-        }
-      }
+    const auto sum{hasher.sum32bit(i)};
+    const auto pw_idx{(sum >> 8) & 0xf};
+    if (res.pw1.size() < Result::password_len) {
+      res.pw1 += std::format("{:x}", pw_idx);
     }
-    if (res.is_complete()) {
-      return res;
+    if (pw_idx < Result::password_len and res.pw2[pw_idx] == 0) {
+      const auto pw_str{std::format("{:x}", (sum >> 4) & 0xf)};
+      res.pw2[pw_idx] = pw_str.front();
     }
   }
-
-  throw std::runtime_error("search space exhausted, no answer");
+  return res;
 }
 
 int main() {
@@ -90,7 +70,9 @@ int main() {
   std::string msg;
   std::cin >> msg;
 
-  const auto [part1, part2]{parallel_find_passwords(msg)};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return parallel_find_passwords(msg);
+  })};
 
   std::println("{} {}", part1, part2);
   return 0;
@@ -25,12 +25,14 @@ CharPairs minmax_char_freq_by_column(const auto& lines) {
 }
 
 int main() {
-  const auto lines{aoc::parse_items<std::string>("/dev/stdin")};
+  const auto lines{aoc::timed("parse", [] { return aoc::parse_items<std::string>("/dev/stdin"); })};
   if (lines.empty()) {
     throw std::runtime_error("input must not be empty");
   }
 
-  const CharPairs minmax_chars{minmax_char_freq_by_column(lines)};
+  const CharPairs minmax_chars{aoc::timed("part1 and part2", [&] {
+    return minmax_char_freq_by_column(lines);
+  })};
 
   const auto part1{views::elements<1>(minmax_chars) | ranges::to<std::string>()};
   const auto part2{views::elements<0>(minmax_chars) | ranges::to<std::string>()};
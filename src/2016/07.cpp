@@ -95,10 +95,10 @@ std::istream& operator>>(std::istream& is, IP& ip) {
 }
 
 int main() {
-  const auto ips{aoc::parse_items<IP>("/dev/stdin")};
+  const auto ips{aoc::timed("parse", [] { return aoc::parse_items<IP>("/dev/stdin"); })};
 
-  const auto part1{ranges::count_if(ips, supports_tls)};
-  const auto part2{ranges::count_if(ips, supports_ssl)};
+  const auto part1{aoc::timed("part1", [&] { return ranges::count_if(ips, supports_tls); })};
+  const auto part2{aoc::timed("part2", [&] { return ranges::count_if(ips, supports_ssl); })};
 
   std::println("{} {}", part1, part2);
 
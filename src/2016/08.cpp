@@ -138,8 +138,10 @@ std::string decode_ascii(const Screen& screen) {
 constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
 
 int main() {
-  const auto instructions{aoc::parse_items<Instruction>("/dev/stdin")};
-  const auto screen{run_instructions(instructions)};
+  const auto instructions{aoc::timed("parse", [] {
+    return aoc::parse_items<Instruction>("/dev/stdin");
+  })};
+  const auto screen{aoc::timed("part1 and part2", [&] { return run_instructions(instructions); })};
 
   const auto part1{sum(screen)};
   const auto part2{decode_ascii(screen)};
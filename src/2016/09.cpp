@@ -78,10 +78,14 @@ std::istream& operator>>(std::istream& is, Marker& marker) {
 }
 
 int main() {
-  const auto markers{aoc::parse_items<Marker>("/dev/stdin")};
-
-  const auto part1{count_decompressed(markers, Method::simple)};
-  const auto part2{count_decompressed(markers, Method::repeating)};
+  const auto markers{aoc::timed("parse", [] { return aoc::parse_items<Marker>("/dev/stdin"); })};
+
+  const auto part1{aoc::timed("part1", [&] {
+    return count_decompressed(markers, Method::simple);
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return count_decompressed(markers, Method::repeating);
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -165,8 +165,10 @@ std::istream& operator>>(std::istream& is, Instruction& ins) {
 }
 
 int main() {
-  const auto instructions{aoc::parse_items<Instruction>("/dev/stdin")};
-  const auto [part1, part2]{search(instructions)};
+  const auto instructions{aoc::timed("parse", [] {
+    return aoc::parse_items<Instruction>("/dev/stdin");
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(instructions); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
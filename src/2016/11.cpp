@@ -401,16 +401,20 @@ FloorState parse_init_state(std::string_view path) {
 }
 
 int main() {
-  const FloorState init_state{parse_init_state("/dev/stdin")};
+  const FloorState init_state{aoc::timed("parse", [] { return parse_init_state("/dev/stdin"); })};
 
   FloorState begin1{init_state};
-  const auto part1{a_star_search(begin1, as_end_state(begin1))};
+  const auto part1{aoc::timed("part1", [&] {
+    return a_star_search(begin1, as_end_state(begin1));
+  })};
 
   FloorState begin2{init_state};
   for (std::size_t i{N_FLOORS * init_state.count()}; i < begin2.size(); i += N_FLOORS) {
     begin2[i] = true;
   }
-  const auto part2{a_star_search(begin2, as_end_state(begin2))};
+  const auto part2{aoc::timed("part2", [&] {
+    return a_star_search(begin2, as_end_state(begin2));
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -73,8 +73,8 @@ auto find_part2(unsigned designer_num, unsigned step_limit) {
 
 int main() {
   if (unsigned input{}; std::cin >> input) {
-    const auto part1{find_part1(input)};
-    const auto part2{find_part2(input, 50)};
+    const auto part1{aoc::timed("part1", [&] { return find_part1(input); })};
+    const auto part2{aoc::timed("part2", [&] { return find_part2(input, 50); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
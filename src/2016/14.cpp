@@ -1,41 +1,27 @@
 #include "aoc.hpp"
 #include "md5.hpp"
 #include "my_std.hpp"
+#include "parallel.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
 namespace views = std::views;
 
-struct ThreadPool {
-  static constexpr auto chunk_size{256U};
-  std::vector<std::thread> threads;
-  std::vector<std::string> results;
-
-  explicit ThreadPool(unsigned n_threads)
-      : threads(n_threads), results(1UZ * chunk_size * n_threads) {
-  }
-
-  void join() {
-    ranges::for_each(threads, [](auto& t) { t.join(); });
-  }
-
-  void md5stretch(std::string_view salt, std::size_t index, int thread_id, int stretch_count) {
-    const auto offset{thread_id * chunk_size};
-    for (unsigned i{}; i < chunk_size; ++i) {
-      auto checksum{std::format("{:s}{:d}", salt, index + offset + i)};
-      for (int r{}; r <= stretch_count; r += 1) {
-        checksum = md5::hexdigest(md5::sum(checksum));
+void md5stretch(
+    std::span<std::string> checksums,
+    const md5::PrefixHasher& salt,
+    std::size_t index,
+    int stretch_count
+) {
+  for (auto i{0UZ}; i < checksums.size(); i += md5::lanes) {
+    const auto sums{md5::stretch_batch(salt.sum_batch(index + i), stretch_count)};
+    for (auto&& [lane, sum] : my_std::views::enumerate(sums)) {
+      if (i + lane < checksums.size()) {
+        checksums[i + lane] = md5::hexdigest(sum);
       }
-      results.at(offset + i) = checksum;
     }
   }
-
-  void submit(std::string_view salt, std::size_t index, int stretch_count) {
-    for (auto&& [t, th] : my_std::views::enumerate(threads)) {
-      th = std::thread(&ThreadPool::md5stretch, this, salt, index, t, stretch_count);
-    }
-  }
-};
+}
 
 // TODO (llvm21?) ranges::adjacent
 inline auto window3(std::string_view s) {
@@ -67,15 +53,26 @@ auto stretch_search(std::string_view salt, const int stretch_count = 0) {
   // accessed 2024-05-26
   int index{};
 
-  ThreadPool pool(std::max(1U, std::thread::hardware_concurrency()));
+  constexpr std::size_t round_size{1UZ << 12};
+  constexpr std::size_t block_size{1UZ << 8};
+
+  auto& pool{parallel::thread_pool()};
+  const md5::PrefixHasher salt_hasher{salt};
   std::vector<std::string> checksums;
 
   for (int key{}; key < 64; key += 1) {
     for (bool found{false}; not found; index += 1) {
       while (index + 1000 >= checksums.size()) {
-        pool.submit(salt, checksums.size(), stretch_count);
-        pool.join();
-        checksums.append_range(pool.results);
+        const auto begin{checksums.size()};
+        checksums.resize(begin + round_size);
+        pool.parallel_for(begin, checksums.size(), block_size, [&](auto first, auto last) {
+          md5stretch(
+              std::span(checksums).subspan(first, last - first),
+              salt_hasher,
+              first,
+              stretch_count
+          );
+        });
       }
       const auto& checksum{checksums.at(index)};
       if (auto triple{find_triple(checksum)}) {
@@ -92,8 +89,8 @@ auto stretch_search(std::string_view salt, const int stretch_count = 0) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (std::string salt; std::cin >> salt) {
-    const auto part1{stretch_search(salt)};
-    const auto part2{stretch_search(salt, 2016)};
+    const auto part1{aoc::timed("part1", [&] { return stretch_search(salt); })};
+    const auto part2{aoc::timed("part2", [&] { return stretch_search(salt, 2016); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
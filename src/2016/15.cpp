@@ -42,12 +42,12 @@ auto find_time_to_press(const auto& discs) {
 }
 
 int main() {
-  auto discs{aoc::parse_items<Disc>("/dev/stdin")};
+  auto discs{aoc::timed("parse", [] { return aoc::parse_items<Disc>("/dev/stdin"); })};
 
-  const auto part1{find_time_to_press(discs)};
+  const auto part1{aoc::timed("part1", [&] { return find_time_to_press(discs); })};
 
   discs.push_back({0, 11});
-  const auto part2{find_time_to_press(discs)};
+  const auto part2{aoc::timed("part2", [&] { return find_time_to_press(discs); })};
 
   std::println("{} {}", part1, part2);
 
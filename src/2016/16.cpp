@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "my_std.hpp"
 #include "std.hpp"
 
@@ -44,8 +45,8 @@ int main() {
   std::ios::sync_with_stdio(false);
   if (std::string input;
       std::cin >> input and ranges::all_of(input, [](char ch) { return ch == '1' or ch == '0'; })) {
-    const auto part1{search_checksum(input, 272)};
-    const auto part2{search_checksum(input, 35651584)};
+    const auto part1{aoc::timed("part1", [&] { return search_checksum(input, 272); })};
+    const auto part2{aoc::timed("part2", [&] { return search_checksum(input, 35651584); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
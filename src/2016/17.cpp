@@ -48,7 +48,7 @@ auto search(const std::string& passcode) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (std::string passcode; std::cin >> passcode and ranges::all_of(passcode, aoc::is_lower)) {
-    const auto [part1, part2]{search(passcode)};
+    const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(passcode); })};
     std::println("{} {}", part1, part2.size());
     return 0;
   }
@@ -56,10 +56,10 @@ std::istream& operator>>(std::istream& is, Tile& tile) {
 }
 
 int main() {
-  const auto tiles{aoc::parse_items<Tile>("/dev/stdin")};
+  const auto tiles{aoc::timed("parse", [] { return aoc::parse_items<Tile>("/dev/stdin"); })};
 
-  const auto part1{count_safe_tiles(tiles, 40)};
-  const auto part2{count_safe_tiles(tiles, 400'000)};
+  const auto part1{aoc::timed("part1", [&] { return count_safe_tiles(tiles, 40); })};
+  const auto part2{aoc::timed("part2", [&] { return count_safe_tiles(tiles, 400'000); })};
 
   std::println("{} {}", part1, part2);
 
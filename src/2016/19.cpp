@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "std.hpp"
 
 long josephus(const auto n) {
@@ -29,8 +30,10 @@ int ilog2(long x) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (int n_elves{}; std::cin >> n_elves and n_elves > 0) {
-    const auto part1{1 + 2 * (n_elves - ipow2(ilog2(n_elves)))};
-    const auto part2{josephus(n_elves)};
+    const auto part1{aoc::timed("part1", [&] {
+      return 1 + 2 * (n_elves - ipow2(ilog2(n_elves)));
+    })};
+    const auto part2{aoc::timed("part2", [&] { return josephus(n_elves); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
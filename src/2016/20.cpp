@@ -49,14 +49,18 @@ std::istream& operator>>(std::istream& is, Range& range) {
 }
 
 int main() {
-  const auto excluded_ranges{aoc::parse_items<Range>("/dev/stdin")};
+  const auto excluded_ranges{aoc::timed("parse", [] {
+    return aoc::parse_items<Range>("/dev/stdin");
+  })};
 
   const auto allowed{find_allowed(excluded_ranges)};
   if (allowed.empty()) {
     throw std::runtime_error("entire range is excluded");
   }
 
-  const auto part1{ranges::min(views::transform(allowed, &Range::begin))};
+  const auto part1{aoc::timed("part1", [&] {
+    return ranges::min(views::transform(allowed, &Range::begin));
+  })};
   const auto part2{
       sum(views::transform(allowed, [](const auto& r) { return r.end - r.begin + 1; }))
   };
@@ -198,10 +198,16 @@ std::istream& operator>>(std::istream& is, Operation& op) {
 }
 
 int main() {
-  const auto operations{aoc::parse_items<Operation>("/dev/stdin")};
-
-  const auto part1{ranges::fold_left(operations, "abcdefgh"s, scramble)};
-  const auto part2{ranges::fold_left(invert(operations), "fbgdceah"s, scramble)};
+  const auto operations{aoc::timed("parse", [] {
+    return aoc::parse_items<Operation>("/dev/stdin");
+  })};
+
+  const auto part1{aoc::timed("part1", [&] {
+    return ranges::fold_left(operations, "abcdefgh"s, scramble);
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return ranges::fold_left(invert(operations), "fbgdceah"s, scramble);
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -93,10 +93,10 @@ auto parse_nodes(std::string_view path) {
 }
 
 int main() {
-  const auto nodes{parse_nodes("/dev/stdin")};
+  const auto nodes{aoc::timed("parse", [] { return parse_nodes("/dev/stdin"); })};
 
-  const auto part1{count_viable_pairs(nodes)};
-  const auto part2{find_shortest_path(nodes)};
+  const auto part1{aoc::timed("part1", [&] { return count_viable_pairs(nodes); })};
+  const auto part2{aoc::timed("part2", [&] { return find_shortest_path(nodes); })};
 
   std::println("{} {}", part1, part2);
 
@@ -105,8 +105,8 @@ Grid parse_grid(std::string_view path) {
 }
 
 int main() {
-  const Grid g{parse_grid("/dev/stdin")};
-  const auto [part1, part2]{search_min_paths(g)};
+  const Grid g{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search_min_paths(g); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -23,13 +23,13 @@ auto parse_digits(std::string_view path) {
 }
 
 int main() {
-  const auto digits{parse_digits("/dev/stdin")};
+  const auto digits{aoc::timed("parse", [] { return parse_digits("/dev/stdin"); })};
   if (digits.empty() or digits.size() % 2 != 0) {
     throw std::runtime_error("input needs to contain an even amount of digits");
   }
 
-  const auto part1{solve(digits, 1)};
-  const auto part2{solve(digits, digits.size() / 2)};
+  const auto part1{aoc::timed("part1", [&] { return solve(digits, 1); })};
+  const auto part2{aoc::timed("part2", [&] { return solve(digits, digits.size() / 2); })};
 
   std::println("{} {}", part1, part2);
 
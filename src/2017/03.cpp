@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "ndvec.hpp"
 #include "std.hpp"
 
@@ -46,7 +47,7 @@ auto search(int n) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (int n{}; std::cin >> n and n > 0) {
-    const auto [part1, part2]{search(n)};
+    const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(n); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
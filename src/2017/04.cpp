@@ -43,10 +43,10 @@ auto parse_rows(std::string_view path) {
 }
 
 int main() {
-  const auto rows{parse_rows("/dev/stdin")};
+  const auto rows{aoc::timed("parse", [] { return parse_rows("/dev/stdin"); })};
 
-  const auto part1{find_part1(rows)};
-  const auto part2{find_part2(rows)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(rows); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(rows); })};
 
   std::println("{} {}", part1, part2);
 
@@ -12,10 +12,10 @@ auto find_exit(auto jumps, int limit = std::numeric_limits<int>::max()) {
 }
 
 int main() {
-  const auto jumps{aoc::parse_items<int>("/dev/stdin")};
+  const auto jumps{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
 
-  const auto part1{find_exit(jumps)};
-  const auto part2{find_exit(jumps, 3)};
+  const auto part1{aoc::timed("part1", [&] { return find_exit(jumps); })};
+  const auto part2{aoc::timed("part2", [&] { return find_exit(jumps, 3); })};
 
   std::println("{} {}", part1, part2);
 
@@ -38,14 +38,14 @@ auto find_loop(Bank bank) {
 }
 
 int main() {
-  const auto bank{aoc::parse_items<int>("/dev/stdin")};
+  const auto bank{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
   if (bank.size() > 16 or not ranges::all_of(bank, [](auto x) { return 0 <= x and x <= 15; })) {
     throw std::runtime_error(
         "invalid input, input size must be at most 16 and every element must fit into 4 bits"
     );
   }
 
-  const auto [part1, part2]{find_loop(Bank{bank})};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return find_loop(Bank{bank}); })};
   std::println("{} {}", part1, part2);
 
   return 0;
@@ -114,14 +114,14 @@ auto find_balance_weight(const auto& nodes) {
 }
 
 int main() {
-  const auto nodes{
-      aoc::parse_items<Node>("/dev/stdin")
-      | views::transform([](const auto& n) { return std::pair{n.id, n}; })
-      | ranges::to<std::unordered_map>()
-  };
-
-  const auto part1{find_root(nodes).id};
-  const auto part2{find_balance_weight(nodes)};
+  const auto nodes{aoc::timed("parse", [] {
+    return aoc::parse_items<Node>("/dev/stdin")
+           | views::transform([](const auto& n) { return std::pair{n.id, n}; })
+           | ranges::to<std::unordered_map>();
+  })};
+
+  const auto part1{aoc::timed("part1", [&] { return find_root(nodes).id; })};
+  const auto part2{aoc::timed("part2", [&] { return find_balance_weight(nodes); })};
 
   std::println("{} {}", part1, part2);
 
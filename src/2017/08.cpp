@@ -101,8 +101,10 @@ std::istream& operator>>(std::istream& is, Statement& stmt) {
 }
 
 int main() {
-  const auto statements{aoc::parse_items<Statement>("/dev/stdin")};
-  const auto [part1, part2]{search(statements)};
+  const auto statements{aoc::timed("parse", [] {
+    return aoc::parse_items<Statement>("/dev/stdin");
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(statements); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
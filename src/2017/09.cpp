@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "std.hpp"
 
 auto parse_garbage(std::string_view s) {
@@ -84,7 +85,7 @@ auto parse_garbage(std::string_view s) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (std::string input; std::cin >> input) {
-    const auto [part1, part2]{parse_garbage(input)};
+    const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return parse_garbage(input); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
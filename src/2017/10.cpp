@@ -58,8 +58,8 @@ auto compute_part2(std::string input) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (std::string input; std::cin >> input) {
-    const auto part1{compute_part1(input)};
-    const auto part2{compute_part2(input)};
+    const auto part1{aoc::timed("part1", [&] { return compute_part1(input); })};
+    const auto part2{aoc::timed("part2", [&] { return compute_part2(input); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
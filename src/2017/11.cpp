@@ -55,8 +55,10 @@ std::istream& operator>>(std::istream& is, Hex& h) {
 }
 
 int main() {
-  const auto steps{aoc::parse_items<Hex>("/dev/stdin", ',')};
-  const auto [part1, part2]{measure_distances(steps)};
+  const auto steps{aoc::timed("parse", [] { return aoc::parse_items<Hex>("/dev/stdin", ','); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return measure_distances(steps);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -67,8 +67,8 @@ Graph parse_graph(std::string_view path) {
 }
 
 int main() {
-  Graph g{parse_graph("/dev/stdin")};
-  const auto [part1, part2]{find_group_sizes(g)};
+  Graph g{aoc::timed("parse", [] { return parse_graph("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return find_group_sizes(g); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
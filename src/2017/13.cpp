@@ -52,10 +52,10 @@ std::istream& operator>>(std::istream& is, Scanner& scanner) {
 }
 
 int main() {
-  const auto scanners{aoc::parse_items<Scanner>("/dev/stdin")};
+  const auto scanners{aoc::timed("parse", [] { return aoc::parse_items<Scanner>("/dev/stdin"); })};
 
-  const auto part1{find_part1(scanners)};
-  const auto part2{find_part2(scanners)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(scanners); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(scanners); })};
 
   std::println("{} {}", part1, part2);
 
@@ -98,10 +98,10 @@ auto compute_part2(const auto& rows) {
 }
 
 int main() {
-  const auto rows{parse_rows("/dev/stdin")};
+  const auto rows{aoc::timed("parse", [] { return parse_rows("/dev/stdin"); })};
 
-  const auto part1{compute_part1(rows)};
-  const auto part2{compute_part2(rows)};
+  const auto part1{aoc::timed("part1", [&] { return compute_part1(rows); })};
+  const auto part2{aoc::timed("part2", [&] { return compute_part2(rows); })};
 
   std::println("{} {}", part1, part2);
 
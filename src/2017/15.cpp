@@ -52,10 +52,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [a, b]{parse_input("/dev/stdin")};
+  const auto [a, b]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(a, b)};
-  const auto part2{find_part2(a, b)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(a, b); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(a, b); })};
 
   std::println("{} {}", part1, part2);
 
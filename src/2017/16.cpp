@@ -56,10 +56,10 @@ std::string dance(const auto& moves, const int rounds) {
 }
 
 int main() {
-  const auto moves{aoc::parse_items<Move>("/dev/stdin", ',')};
+  const auto moves{aoc::timed("parse", [] { return aoc::parse_items<Move>("/dev/stdin", ','); })};
 
-  const auto part1{dance(moves, 1)};
-  const auto part2{dance(moves, 1'000'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return dance(moves, 1); })};
+  const auto part2{aoc::timed("part2", [&] { return dance(moves, 1'000'000'000); })};
 
   std::println("{} {}", part1, part2);
 
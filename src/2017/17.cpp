@@ -1,13 +1,14 @@
+#include "aoc.hpp"
 #include "std.hpp"
 
 auto find_part1(const auto steps) {
-  std::vector<unsigned long> buf{0};
-  long i{};
+  aoc::BlockList buf(2018, std::array{0UZ});
+  auto i{0UZ};
   while (buf.size() < 2018) {
     i = 1 + (i + steps) % buf.size();
-    buf.insert(buf.begin() + i, buf.size());
+    buf.insert(i, buf.size());
   }
-  return buf.at(i + 1);
+  return buf.at((i + 1) % buf.size());
 }
 
 auto find_part2(const auto steps) {
@@ -24,8 +25,8 @@ auto find_part2(const auto steps) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (int steps{}; std::cin >> steps and steps > 0) {
-    const auto part1{find_part1(steps)};
-    const auto part2{find_part2(steps)};
+    const auto part1{aoc::timed("part1", [&] { return find_part1(steps); })};
+    const auto part2{aoc::timed("part2", [&] { return find_part2(steps); })};
     std::println("{} {}", part1, part2);
     return 0;
   }
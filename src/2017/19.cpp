@@ -127,8 +127,8 @@ auto parse_grid(std::string_view path) {
 }
 
 int main() {
-  const Grid g{parse_grid("/dev/stdin")};
-  const auto [part1, part2]{traverse_diagram(g)};
+  const Grid g{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return traverse_diagram(g); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
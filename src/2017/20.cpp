@@ -109,17 +109,17 @@ std::istream& operator>>(std::istream& is, Particle& particle) {
 }
 
 int main() {
-  const auto particles{
-      my_std::views::enumerate(aoc::parse_items<Particle>("/dev/stdin"))
-      | views::transform(my_std::apply_fn([](auto i, Particle p) {
-          p.id = i;
-          return p;
-        }))
-      | ranges::to<std::vector>()
-  };
-
-  const auto part1{find_part1(particles)};
-  const auto part2{find_part2(particles)};
+  const auto particles{aoc::timed("parse", [] {
+    return my_std::views::enumerate(aoc::parse_items<Particle>("/dev/stdin"))
+           | views::transform(my_std::apply_fn([](auto i, Particle p) {
+               p.id = i;
+               return p;
+             }))
+           | ranges::to<std::vector>();
+  })};
+
+  const auto part1{aoc::timed("part1", [&] { return find_part1(particles); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(particles); })};
 
   std::println("{} {}", part1, part2);
 
@@ -132,9 +132,9 @@ auto parse_rules(std::string_view path) {
 }
 
 int main() {
-  const auto rules{parse_rules("/dev/stdin")};
+  const auto rules{aoc::timed("parse", [] { return parse_rules("/dev/stdin"); })};
 
-  const auto expanded{expand(rules, 18)};
+  const auto expanded{aoc::timed("part1 and part2", [&] { return expand(rules, 18); })};
   const auto part1{ranges::count(expanded[5].str, '#')};
   const auto part2{ranges::count(expanded[18].str, '#')};
 
@@ -75,10 +75,10 @@ auto parse_grid(std::string_view path) {
 }
 
 int main() {
-  const auto [grid, begin]{parse_grid("/dev/stdin")};
+  const auto [grid, begin]{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{count_part1(grid, begin, 10'000)};
-  const auto part2{count_part2(grid, begin, 10'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return count_part1(grid, begin, 10'000); })};
+  const auto part2{aoc::timed("part2", [&] { return count_part2(grid, begin, 10'000'000); })};
 
   std::println("{} {}", part1, part2);
 
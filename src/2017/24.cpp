@@ -60,8 +60,12 @@ std::istream& operator>>(std::istream& is, Component& comp) {
 }
 
 int main() {
-  const auto components{aoc::parse_items<Component>("/dev/stdin")};
-  const auto [part1, part2]{find_max_bridges(components)};
+  const auto components{aoc::timed("parse", [] {
+    return aoc::parse_items<Component>("/dev/stdin");
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return find_max_bridges(components);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -80,10 +80,12 @@ auto parse_start_state(std::istream& is) {
 
 int main() {
   std::istringstream input{aoc::slurp_file("/dev/stdin")};
-  const auto [begin, steps]{parse_start_state(input)};
-  const auto states{views::istream<State>(input) | ranges::to<std::vector>()};
+  const auto [begin, steps]{aoc::timed("parse", [&] { return parse_start_state(input); })};
+  const auto states{aoc::timed("parse", [&] {
+    return views::istream<State>(input) | ranges::to<std::vector>();
+  })};
 
-  const auto part1{find_part1(begin, steps, states)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(begin, steps, states); })};
   std::print("{}\n", part1);
 
   return 0;
@@ -19,8 +19,8 @@ auto find_frequencies(const auto& items) {
 }
 
 int main() {
-  const auto items{aoc::parse_items<int>("/dev/stdin")};
-  const auto [part1, part2]{find_frequencies(items)};
+  const auto items{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return find_frequencies(items); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -68,8 +68,8 @@ std::istream& operator>>(std::istream& is, Claim& claim) {
 }
 
 int main() {
-  const auto claims{aoc::parse_items<Claim>("/dev/stdin")};
-  const auto [part1, part2]{count_squares(claims)};
+  const auto claims{aoc::timed("parse", [] { return aoc::parse_items<Claim>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return count_squares(claims); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
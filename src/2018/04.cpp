@@ -93,8 +93,10 @@ auto parse_events(std::string path) {
 }
 
 int main() {
-  const auto events{parse_events("/dev/stdin")};
-  const auto [part1, part2]{find_sleepy_guards(events)};
+  const auto events{aoc::timed("parse", [] { return parse_events("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return find_sleepy_guards(events);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
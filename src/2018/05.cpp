@@ -59,10 +59,10 @@ std::istream& operator>>(std::istream& is, Unit& unit) {
 }
 
 int main() {
-  const auto polymer{aoc::parse_items<Unit>("/dev/stdin")};
+  const auto polymer{aoc::timed("parse", [] { return aoc::parse_items<Unit>("/dev/stdin"); })};
 
-  const auto part1{react(polymer)};
-  const auto part2{find_part2(polymer)};
+  const auto part1{aoc::timed("part1", [&] { return react(polymer); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(polymer); })};
 
   std::println("{} {}", part1, part2);
 
@@ -63,8 +63,8 @@ auto find_areas(const Points& points) {
 }
 
 int main() {
-  const auto points{aoc::parse_items<Vec2>("/dev/stdin", ',')};
-  const auto [part1, part2]{find_areas(points)};
+  const auto points{aoc::timed("parse", [] { return aoc::parse_items<Vec2>("/dev/stdin", ','); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return find_areas(points); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
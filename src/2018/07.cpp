@@ -83,10 +83,10 @@ std::istream& operator>>(std::istream& is, Step& step) {
 }
 
 int main() {
-  const auto steps{aoc::parse_items<Step>("/dev/stdin")};
+  const auto steps{aoc::timed("parse", [] { return aoc::parse_items<Step>("/dev/stdin"); })};
 
-  const auto part1{run_tasks(steps, 1).first};
-  const auto part2{run_tasks(steps, 5).second};
+  const auto part1{aoc::timed("part1", [&] { return run_tasks(steps, 1).first; })};
+  const auto part2{aoc::timed("part2", [&] { return run_tasks(steps, 5).second; })};
 
   std::println("{} {}", part1, part2);
 
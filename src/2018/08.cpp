@@ -34,10 +34,10 @@ std::pair<int, int> find_tree_value(const auto& tree, const bool part1, const in
 }
 
 int main() {
-  const auto tree{aoc::parse_items<int>("/dev/stdin")};
+  const auto tree{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
 
-  const auto part1{find_tree_value(tree, true).second};
-  const auto part2{find_tree_value(tree, false).second};
+  const auto part1{aoc::timed("part1", [&] { return find_tree_value(tree, true).second; })};
+  const auto part2{aoc::timed("part2", [&] { return find_tree_value(tree, false).second; })};
 
   std::println("{} {}", part1, part2);
 
@@ -4,32 +4,50 @@
 using aoc::skip;
 using std::operator""s;
 
-void left_rotate(auto& q, const auto n) {
-  for (int i{}; i < n; ++i) {
-    q.push_back(q.front());
-    q.pop_front();
+// Marbles in clockwise order as a doubly linked list over marble labels, preallocated for all
+// marbles. Marble 0 starts alone, linked to itself.
+struct Circle {
+  using Marble = std::uint32_t;
+  std::vector<Marble> next;
+  std::vector<Marble> prev;
+  Marble current{};
+
+  explicit Circle(const std::size_t n_marbles) : next(n_marbles), prev(n_marbles) {
   }
-}
 
-void right_rotate(auto& q, const auto n) {
-  for (int i{}; i < n; ++i) {
-    q.push_front(q.back());
-    q.pop_back();
+  // Place marble between the first and second marble clockwise of the current marble
+  void insert(const Marble marble) {
+    const auto left{next[current]};
+    const auto right{next[left]};
+    next[left] = prev[right] = marble;
+    prev[marble] = left;
+    next[marble] = right;
+    current = marble;
   }
-}
+
+  // Remove the marble k marbles counter-clockwise of the current marble, the marble clockwise of
+  // the removed one becomes current
+  Marble remove_back(const int k) {
+    auto marble{current};
+    for (int i{}; i < k; ++i) {
+      marble = prev[marble];
+    }
+    next[prev[marble]] = next[marble];
+    prev[next[marble]] = prev[marble];
+    current = next[marble];
+    return marble;
+  }
+};
 
 auto find_winning_score(const auto n_players, const auto max_marble) {
   std::vector<long> scores(n_players, 0);
-  std::deque marbles{0L};
+  Circle circle(max_marble + 1);
 
   for (int marble{1}; marble <= max_marble; ++marble) {
     if (marble % 23 == 0) {
-      right_rotate(marbles, 7);
-      scores[marble % scores.size()] += marble + marbles.front();
-      marbles.pop_front();
+      scores[marble % scores.size()] += marble + circle.remove_back(7);
     } else {
-      left_rotate(marbles, 2);
-      marbles.push_front(marble);
+      circle.insert(marble);
     }
   }
 
@@ -47,10 +65,12 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [n_players, max_marble]{parse_input("/dev/stdin")};
+  const auto [n_players, max_marble]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_winning_score(n_players, max_marble)};
-  const auto part2{find_winning_score(n_players, 100 * max_marble)};
+  const auto part1{aoc::timed("part1", [&] { return find_winning_score(n_players, max_marble); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return find_winning_score(n_players, 100 * max_marble);
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -73,8 +73,10 @@ std::istream& operator>>(std::istream& is, Light& light) {
 }
 
 int main() {
-  const auto lights{aoc::parse_items<Light>("/dev/stdin", ',')};
-  const auto [part1, part2]{wait_for_message(lights)};
+  const auto lights{aoc::timed("parse", [] { return aoc::parse_items<Light>("/dev/stdin", ','); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return wait_for_message(lights);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
@@ -52,7 +53,7 @@ auto search(const int serial) {
 int main() {
   std::ios::sync_with_stdio(false);
   if (int serial{}; std::cin >> serial and serial > 0) {
-    const auto results{search(serial)};
+    const auto results{aoc::timed("part1 and part2", [&] { return search(serial); })};
     const auto sq_3{results[2]};
     const auto part1{std::format("{},{}", sq_3.x, sq_3.y)};
     const auto sq_max{ranges::max_element(results, ranges::less{}, &Result::power)};
@@ -93,10 +93,12 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [init_state, rules]{parse_input("/dev/stdin")};
+  const auto [init_state, rules]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{generate_plants(init_state, rules, 20)};
-  const auto part2{generate_plants(init_state, rules, 50'000'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return generate_plants(init_state, rules, 20); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return generate_plants(init_state, rules, 50'000'000'000);
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -202,9 +202,9 @@ auto parse_state(std::string_view path) {
 }
 
 int main() {
-  const auto [grid, carts]{parse_state("/dev/stdin")};
+  const auto [grid, carts]{aoc::timed("parse", [] { return parse_state("/dev/stdin"); })};
 
-  const auto [part1, part2]{run(grid, carts)};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return run(grid, carts); })};
   std::println("{} {}", part1, part2);
 
   return 0;
@@ -59,8 +59,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [target, digits]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search_for_recipes(target, digits)};
+  const auto [target, digits]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search_for_recipes(target, digits);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -244,10 +244,10 @@ Cave parse_cave(std::string path) {
 }
 
 int main() {
-  const auto cave{parse_cave("/dev/stdin")};
+  const auto cave{aoc::timed("parse", [] { return parse_cave("/dev/stdin"); })};
 
-  const auto part1{find_part1(cave)};
-  const auto part2{find_part2(cave)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(cave); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(cave); })};
 
   std::println("{} {}", part1, part2);
 
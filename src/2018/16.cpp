@@ -1,4 +1,5 @@
 #include "aoc.hpp"
+#include "regvm.hpp"
 #include "std.hpp"
 
 using aoc::skip;
@@ -47,6 +48,8 @@ inline constexpr auto update{
     }
 };
 
+// Sample matching tries every opcode on every sample, so the opcodes are evaluated directly
+// instead of through a regvm::Machine, which is used only to run the program of part 2
 auto compute(Memory mem, const Instruction& ins, const auto& op) {
   if (op == "setr"s) {
     mem.at(ins.c) = mem.at(ins.a);
@@ -121,12 +124,15 @@ auto resolve_samples(const auto& samples) {
 
 auto find_part2(const auto& samples, const auto& instructions) {
   const auto id2op{resolve_samples(samples)};
-  Memory mem;
-  mem.fill(0);
+  regvm::Program program{.n_registers = Memory{}.size()};
   for (const auto& ins : instructions) {
-    mem = compute(mem, ins, id2op[ins.op_id]);
+    program.instructions.push_back(
+        regvm::elf_instruction(id2op[ins.op_id], ins.a, ins.b, ins.c).value()
+    );
   }
-  return mem.front();
+  regvm::Machine m(program);
+  m.run();
+  return m.reg(0);
 }
 
 std::istream& operator>>(std::istream& is, Memory& memory) {
@@ -183,10 +189,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [samples, instructions]{parse_input("/dev/stdin")};
+  const auto [samples, instructions]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(samples)};
-  const auto part2{find_part2(samples, instructions)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(samples); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(samples, instructions); })};
 
   std::println("{} {}", part1, part2);
 
@@ -116,8 +116,8 @@ std::istream& operator>>(std::istream& is, Area& area) {
 }
 
 int main() {
-  const auto areas{aoc::parse_items<Area>("/dev/stdin")};
-  const auto [part1, part2]{count_water(areas)};
+  const auto areas{aoc::timed("parse", [] { return aoc::parse_items<Area>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return count_water(areas); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
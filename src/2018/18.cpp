@@ -1,11 +1,10 @@
 #include "aoc.hpp"
-#include "ndvec.hpp"
+#include "cellular.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
-namespace views = std::views;
 
-using Vec2 = ndvec::vec2<int>;
+using Board = cellular::Board<2>;
 
 enum class Tile : char {
   open = '.',
@@ -13,99 +12,81 @@ enum class Tile : char {
   yard = '#',
 };
 
-using TileMap = std::map<Vec2, Tile>;
-
 struct Grid {
-  TileMap tiles;
-
-  [[nodiscard]]
-  auto count(Tile t) const {
-    return ranges::count(tiles | views::values, t);
-  }
-
-  [[nodiscard]]
-  int count_adjacent(const Vec2& center, Tile t) const {
-    int n{};
-    for (Vec2 d(-1, -1); d.x() <= 1; d.x() += 1) {
-      for (d.y() = -1; d.y() <= 1; d.y() += 1) {
-        if (Vec2 p{center + d}; p != center and tiles.contains(p) and tiles.at(p) == t) {
-          n += 1;
-        }
-      }
-    }
-    return n;
-  }
+  Board trees;
+  Board yards;
 
   [[nodiscard]]
   Grid step() const {
-    Grid after{*this};
-    for (auto&& [p, tile] : tiles) {
-      const auto n_trees{count_adjacent(p, Tile::tree)};
-      const auto n_yards{count_adjacent(p, Tile::yard)};
-      switch (tile) {
-        case Tile::open: {
-          if (n_trees >= 3) {
-            after.tiles[p] = Tile::tree;
-          }
-        } break;
-        case Tile::tree: {
-          if (n_yards >= 3) {
-            after.tiles[p] = Tile::yard;
-          }
-        } break;
-        case Tile::yard: {
-          if (n_yards > 0 and n_trees > 0) {
-            after.tiles[p] = Tile::yard;
-          } else {
-            after.tiles[p] = Tile::open;
-          }
-        } break;
-      }
+    const auto tree_counts{cellular::moore_counts(trees)};
+    const auto yard_counts{cellular::moore_counts(yards)};
+    Grid after{Board(trees.shape()), Board(trees.shape())};
+    const auto mask{trees.last_word_mask()};
+    const auto row_words{trees.row_words()};
+    for (auto i{0UZ}; i < tree_counts.size(); ++i) {
+      const auto tree{trees.words()[i]};
+      const auto yard{yards.words()[i]};
+      const auto open{~(tree | yard) & ((i + 1) % row_words == 0 ? mask : ~cellular::Word{})};
+      // counts include the cell itself, which is never both a tree and a yard
+      const auto& n_trees{tree_counts[i]};
+      const auto& n_yards{yard_counts[i]};
+      after.trees.words()[i] = (open & n_trees.at_least(3)) | (tree & ~n_yards.at_least(3));
+      after.yards.words()[i]
+          = (tree & n_yards.at_least(3)) | (yard & n_yards.at_least(2) & n_trees.at_least(1));
     }
     return after;
   }
+
+  bool operator==(const Grid&) const = default;
 };
 
 auto simulate(Grid grid, const auto t_limit) {
-  std::vector<TileMap> seen;
+  std::vector<Grid> seen;
   for (int t{}; t < t_limit; ++t) {
-    if (const auto prev{ranges::find(seen, grid.tiles)}; prev != seen.end()) {
+    if (const auto prev{ranges::find(seen, grid)}; prev != seen.end()) {
       const auto cycle_len{ranges::distance(prev, seen.end())};
-      grid.tiles = prev[(t_limit - t) % cycle_len];
+      grid = prev[(t_limit - t) % cycle_len];
       break;
     }
-    seen.push_back(grid.tiles);
+    seen.push_back(grid);
     grid = grid.step();
   }
-  return grid.count(Tile::tree) * grid.count(Tile::yard);
+  return grid.trees.count() * grid.yards.count();
 }
 
 Grid parse_grid(std::string_view path) {
-  Grid g;
-  for (Vec2 p; const std::string& line : aoc::slurp_lines(path)) {
-    p.x() = 0;
-    for (char ch : line) {
+  const auto lines{aoc::slurp_lines(path)};
+  const Board::Index shape{static_cast<int>(lines.front().size()), static_cast<int>(lines.size())};
+  Grid g{Board(shape), Board(shape)};
+  for (int y{}; const std::string& line : lines) {
+    if (line.size() != lines.front().size()) {
+      throw std::runtime_error("every row must be of same width");
+    }
+    for (int x{}; char ch : line) {
       switch (ch) {
         case std::to_underlying(Tile::open):
-        case std::to_underlying(Tile::tree):
+          break;
+        case std::to_underlying(Tile::tree): {
+          g.trees.set({x, y});
+        } break;
         case std::to_underlying(Tile::yard): {
-          g.tiles[p] = {ch};
+          g.yards.set({x, y});
         } break;
         default:
           throw std::runtime_error(std::format("unknown tile '{}'", ch));
       }
-      p.x() += 1;
+      x += 1;
     }
-    p.y() += 1;
+    y += 1;
   }
   return g;
 }
 
 int main() {
-  const auto grid{parse_grid("/dev/stdin")};
+  const auto grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{simulate(grid, 10)};
-  const auto part2{simulate(grid, 1'000'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return simulate(grid, 10); })};
+  const auto part2{aoc::timed("part2", [&] { return simulate(grid, 1'000'000'000); })};
 
   std::println("{} {}", part1, part2);
 
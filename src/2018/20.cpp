@@ -131,8 +131,8 @@ std::istream& operator>>(std::istream& is, Token& token) {
 }
 
 int main() {
-  const auto tokens{aoc::parse_items<Token>("/dev/stdin")};
-  const auto [part1, part2]{search_paths(tokens)};
+  const auto tokens{aoc::timed("parse", [] { return aoc::parse_items<Token>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search_paths(tokens); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
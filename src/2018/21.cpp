@@ -1,112 +1,60 @@
 #include "aoc.hpp"
+#include "my_std.hpp"
+#include "regvm.hpp"
 #include "std.hpp"
 
-using aoc::skip;
-using std::operator""s;
+using regvm::Int;
 
-namespace ranges = std::ranges;
-namespace views = std::views;
-
-enum class Op : signed char {
-  addi = 0,
-  addr,
-  bani,
-  banr,
-  bori,
-  borr,
-  eqir,
-  eqri,
-  eqrr,
-  gtir,
-  gtri,
-  gtrr,
-  muli,
-  mulr,
-  seti,
-  setr,
-};
-const std::unordered_map<std::string, Op> str2op{
-    {"addi"s, Op::addi},
-    {"addr"s, Op::addr},
-    {"bani"s, Op::bani},
-    {"banr"s, Op::banr},
-    {"bori"s, Op::bori},
-    {"borr"s, Op::borr},
-    {"eqir"s, Op::eqir},
-    {"eqri"s, Op::eqri},
-    {"eqrr"s, Op::eqrr},
-    {"gtir"s, Op::gtir},
-    {"gtri"s, Op::gtri},
-    {"gtrr"s, Op::gtrr},
-    {"muli"s, Op::muli},
-    {"mulr"s, Op::mulr},
-    {"seti"s, Op::seti},
-    {"setr"s, Op::setr},
-};
-
-struct Instruction {
-  Op op{};
-  long a{};
-  long b{};
-  long c{};
-};
-
-auto run(const auto& instructions) {
-  // https://www.reddit.com/r/adventofcode/comments/a86jgt/comment/ec8lyck
-  // (2024-02-17)
-  long part1{-1};
-  long part2{-1};
-  long c{};
-  for (std::unordered_set<long> seen;;) {
-    auto a{c | 65536};
-    c = instructions[7].a;
-    for (; part2 != c;) {
-      c = (((c + (a & 255)) & 16777215) * 65899) & 16777215;
-      if (a < 256) {
-        if (auto&& [_, unseen]{seen.insert(c)}; not unseen) {
-          return std::pair{part1, part2};
-        }
-        part1 = part1 < 0 ? c : part1;
-        part2 = c;
-      } else {
-        a /= 256;
+// The program halts when the only instruction reading register 0 finds it equal to the
+// halting value register
+auto find_halting_check(const regvm::Program& program) {
+  for (auto&& [ip, ins] : my_std::views::enumerate(program.instructions)) {
+    if (ins.op == regvm::Op::eq and ins.a.is_register and ins.b.is_register) {
+      if (ins.a.value == 0) {
+        return std::pair{static_cast<Int>(ip), ins.b.value};
+      }
+      if (ins.b.value == 0) {
+        return std::pair{static_cast<Int>(ip), ins.a.value};
       }
     }
   }
+  throw std::runtime_error("program never compares register 0");
 }
 
-std::istream& operator>>(std::istream& is, Op& op) {
-  if (std::string s; is >> s) {
-    if (str2op.contains(s)) {
-      op = str2op.at(s);
-    } else {
-      throw std::runtime_error(std::format("unknown elf code opcode '{}'", s));
-    }
-  }
-  return is;
-}
-
-std::istream& operator>>(std::istream& is, Instruction& instruction) {
-  if (Instruction ins; is >> ins.op >> ins.a >> ins.b >> ins.c) {
-    instruction = ins;
-  }
-  return is;
-}
+auto run(const regvm::Program& program) {
+  const auto [check, reg]{find_halting_check(program)};
+  regvm::Machine m(program);
 
-auto parse_input(std::string path) {
-  std::istringstream is{aoc::slurp_file(path)};
-  if (int ip{}; is >> skip("#ip"s) >> ip) {
-    const auto instructions{views::istream<Instruction>(is) | ranges::to<std::vector>()};
-    if (is or is.eof()) {
-      return std::pair{ip, instructions};
+  const auto run_to_check{[&] {
+    if (m.run(check) != regvm::Status::breakpoint) {
+      throw std::runtime_error("program halted before reaching the halting check");
     }
+    return m.reg(reg);
+  }};
+
+  // Every other register is recomputed from the previous halting value, so the next value
+  // depends only on the current one
+  const auto next{[&](const Int c) {
+    m.reg(reg) = c;
+    m.instruction_pointer() = check;
+    return run_to_check();
+  }};
+
+  const auto first{run_to_check()};
+  const auto [start, length]{regvm::find_cycle(first, next)};
+
+  auto last{first};
+  for (auto i{1UZ}; i < start + length; ++i) {
+    last = next(last);
   }
-  throw std::runtime_error("input is not elf code (aoc year 2018)");
+  return std::pair{first, last};
 }
 
 int main() {
-  const auto [_, instructions]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{run(instructions)};
+  const auto program{aoc::timed("parse", [] {
+    return regvm::parse_elf(aoc::slurp_file("/dev/stdin"));
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return run(program); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
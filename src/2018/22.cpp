@@ -2,119 +2,107 @@
 #include "ndvec.hpp"
 #include "std.hpp"
 
-namespace ranges = std::ranges;
-namespace views = std::views;
-
 using aoc::skip;
 using std::operator""s;
 
 using Vec2 = ndvec::vec2<int>;
 
-auto get_erosion(const auto depth, const Vec2& target, const Vec2& p) {
-  static std::unordered_map<Vec2, int> erosion;
-  if (auto it{erosion.find(p)}; it != erosion.end()) {
-    return it->second;
-  }
-  long index{};
-  if ((p.x() == 0 and p.y() == 0) or p == target) {
-    index = 0;
-  } else if (p.x() == 0) {
-    index = p.y() * 48'271L;
-  } else if (p.y() == 0) {
-    index = p.x() * 16'807L;
-  } else {
-    index = get_erosion(depth, target, p - Vec2(0, 1)) * get_erosion(depth, target, p - Vec2(1, 0));
+// Erosion levels of all regions from (0, 0) to (width - 1, height - 1)
+auto erosion_levels(const int depth, const Vec2& target, const int width, const int height) {
+  aoc::Grid2<int> erosion(width, height);
+  // row-major, the regions above and to the left are always done
+  for (Vec2 p : erosion.positions()) {
+    long index{};
+    if (p == Vec2() or p == target) {
+      index = 0;
+    } else if (p.x() == 0) {
+      index = p.y() * 48'271L;
+    } else if (p.y() == 0) {
+      index = p.x() * 16'807L;
+    } else {
+      index = long{erosion[p - Vec2(0, 1)]} * erosion[p - Vec2(1, 0)];
+    }
+    erosion[p] = static_cast<int>((index + depth) % 20183);
   }
-  return (erosion[p] = (index + depth) % 20183);
+  return erosion;
 }
 
 auto find_part1(const auto depth, const Vec2 target) {
+  const auto erosion{erosion_levels(depth, target, target.x() + 1, target.y() + 1)};
   int risk{};
-  for (Vec2 p{}; p.y() <= target.y(); ++p.y()) {
-    for (p.x() = 0; p.x() <= target.x(); ++p.x()) {
-      risk += get_erosion(depth, target, p) % 3;
-    }
+  for (Vec2 p : erosion.positions()) {
+    risk += erosion[p] % 3;
   }
   return risk;
 }
 
-struct State {
-  Vec2 pos;
-  int tool{};
-
-  auto operator<=>(const State&) const = default;
-};
-
-template <>
-struct std::hash<State> {
-  constexpr std::size_t operator()(const State& s) const noexcept {
-    return (std::hash<Vec2>{}(s.pos) << 2) | s.tool;
-  }
+enum Tool : int {
+  torch,
+  climbing_gear,
+  neither,
 };
 
-auto find_part2(const auto depth, const Vec2 target) {
-  // Dijkstra
-  std::unordered_map<State, int> time;
-  const auto time_to_reach{[&time](const State& s) {
-    if (const auto it{time.find(s)}; it != time.end()) {
-      return it->second;
-    }
-    return std::numeric_limits<int>::max();
-  }};
-
-  std::vector<State> q;
-  const auto push_min_time_heap{[&](State s) {
-    q.push_back(s);
-    ranges::push_heap(q, ranges::greater{}, time_to_reach);
-  }};
-
-  const auto pop_min_time_heap{[&] {
-    ranges::pop_heap(q, ranges::greater{}, time_to_reach);
-    auto state{q.back()};
-    q.pop_back();
-    return state;
-  }};
+constexpr int outside{3};
 
-  const State begin{};
-  const State end{.pos = target};
+// rocky  0 : torch 0 or climb 1 => not empty 2
+// wet    1 : climb 1 or empty 2 => not torch 0
+// narrow 2 : empty 2 or torch 0 => not climb 1
+constexpr bool allows(const int region, const int tool) {
+  return region != outside and (region + 2) % 3 != tool;
+}
 
-  q.push_back(begin);
-  time[begin] = 0;
+// Shortest time when the search never leaves the regions within margin of the target
+auto find_time_within(const int depth, const Vec2 target, const int margin) {
+  const auto erosion{
+      erosion_levels(depth, target, target.x() + 1 + margin, target.y() + 1 + margin)
+  };
+  aoc::Grid2<int> regions(erosion.width(), erosion.height(), 0, outside);
+  for (Vec2 p : regions.positions()) {
+    regions[p] = erosion[p] % 3;
+  }
 
-  for (std::unordered_set<State> visited; not q.empty();) {
-    State s{pop_min_time_heap()};
-    if (s == end) {
-      break;
-    }
-    if (s.pos.y() < 0 or s.pos.x() < 0) {
-      continue;
-    }
-    if (auto&& [_, unseen]{visited.insert(s)}; not unseen) {
-      continue;
-    }
-    if ((get_erosion(depth, target, s.pos) + 2) % 3 == s.tool) {
-      // rocky  0 : torch 0 or climb 1 => not empty 2
-      // wet    1 : climb 1 or empty 2 => not torch 0
-      // narrow 2 : empty 2 or torch 0 => not climb 1
-      continue;
-    }
-    for (auto adj : s.pos.adjacent()) {
-      for (auto&& [pos, tool, t] : std::array{
-               std::tuple{s.pos, (s.tool + 1) % 3, 7},
-               std::tuple{s.pos, (s.tool + 2) % 3, 7},
-               std::tuple{adj, s.tool, 1},
-           }) {
-        State dst{pos, tool};
-        const auto new_time{aoc::saturating_add(time_to_reach(s), t)};
-        if (new_time < time_to_reach(dst)) {
-          time[dst] = new_time;
-          push_min_time_heap(dst);
+  // A*, every step takes at least 1 minute and swapping to the torch at least 7
+  const auto adjacent{regions.adjacent_offsets()};
+  const auto end{regions.index(target) * 3 + torch};
+  return aoc::shortest_path(
+      regions.buffer_size() * 3,
+      {regions.index(Vec2()) * 3 + torch},
+      [&](const std::size_t s, auto&& relax) {
+        const auto i{s / 3};
+        const auto tool{static_cast<int>(s % 3)};
+        for (const auto other : {(tool + 1) % 3, (tool + 2) % 3}) {
+          if (allows(regions[i], other)) {
+            relax(i * 3 + other, 7);
+          }
         }
+        for (const auto offset : adjacent) {
+          if (const auto adj{i + offset}; allows(regions[adj], tool)) {
+            relax(adj * 3 + tool, 1);
+          }
+        }
+      },
+      [end](const std::size_t s) { return s == end; },
+      [&](const std::size_t s) {
+        return regions.position(s / 3).distance(target) + (s % 3 == torch ? 0 : 7);
+      }
+  );
+}
+
+auto find_part2(const auto depth, const Vec2 target) {
+  for (int margin{64};; margin *= 2) {
+    if (const auto time{find_time_within(depth, target, margin)}) {
+      // any path that goes past the margin is at least this long
+      const auto width{target.x() + 1 + margin};
+      const auto height{target.y() + 1 + margin};
+      const auto bound{std::min(
+          2 * width - target.x() + target.y(),
+          2 * height - target.y() + target.x()
+      )};
+      if (*time <= bound) {
+        return *time;
       }
     }
   }
-
-  return time_to_reach(end);
 }
 
 auto parse_input(std::string path) {
@@ -130,10 +118,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [depth, target]{parse_input("/dev/stdin")};
+  const auto [depth, target]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(depth, target)};
-  const auto part2{find_part2(depth, target)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(depth, target); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(depth, target); })};
 
   std::println("{} {}", part1, part2);
 
@@ -73,10 +73,10 @@ std::istream& operator>>(std::istream& is, Bot& bot) {
 }
 
 int main() {
-  const auto bots{aoc::parse_items<Bot>("/dev/stdin")};
+  const auto bots{aoc::timed("parse", [] { return aoc::parse_items<Bot>("/dev/stdin"); })};
 
-  const auto part1{find_part1(bots)};
-  const auto part2{find_part2(bots)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(bots); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(bots); })};
 
   std::println("{} {}", part1, part2);
 
@@ -278,10 +278,10 @@ std::array<Groups, 2> parse_input(std::string path) {
 }
 
 int main() {
-  const auto teams{parse_input("/dev/stdin")};
+  const auto teams{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(teams)};
-  const auto part2{find_part2(teams)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(teams); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(teams); })};
 
   std::println("{} {}", part1, part2);
 
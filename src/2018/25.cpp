@@ -55,7 +55,7 @@ auto find_part1(const Points& points) {
 }
 
 int main() {
-  const auto points{aoc::parse_items<Vec4>("/dev/stdin", ',')};
-  std::println("{}", find_part1(points));
+  const auto points{aoc::timed("parse", [] { return aoc::parse_items<Vec4>("/dev/stdin", ','); })};
+  std::println("{}", aoc::timed("part1", [&] { return find_part1(points); }));
   return 0;
 }
@@ -17,8 +17,8 @@ auto compute(auto masses) {
 }
 
 int main() {
-  const auto masses{aoc::parse_items<int>("/dev/stdin")};
-  const auto results{compute(masses)};
+  const auto masses{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
+  const auto results{aoc::timed("part1 and part2", [&] { return compute(masses); })};
 
   const auto part1{results.front()};
   const auto part2{sum(results)};
@@ -98,8 +98,8 @@ auto parse_input(const std::string path) {
 }
 
 int main() {
-  const auto [wire1, wire2]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(wire1, wire2)};
+  const auto [wire1, wire2]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(wire1, wire2); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -65,8 +65,8 @@ auto parse_input(const std::string path) {
 }
 
 int main() {
-  const auto [begin, end]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(begin, end)};
+  const auto [begin, end]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(begin, end); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -15,10 +15,12 @@ auto run(const auto& program, const int test_id) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto part1{run(program, 1)};
-  const auto part2{run(program, 5)};
+  const auto part1{aoc::timed("part1", [&] { return run(program, 1); })};
+  const auto part2{aoc::timed("part2", [&] { return run(program, 5); })};
 
   std::println("{} {}", part1, part2);
 
@@ -64,13 +64,13 @@ std::istream& operator>>(std::istream& is, Edge& edge) {
 }
 
 int main() {
-  const auto parents{
-      aoc::parse_items<Edge>("/dev/stdin")
-      | views::transform([](const Edge& e) { return std::pair{e.dst, e.src}; })
-      | ranges::to<std::unordered_map>()
-  };
-  const auto part1{find_part1(parents)};
-  const auto part2{find_part2(parents)};
+  const auto parents{aoc::timed("parse", [] {
+    return aoc::parse_items<Edge>("/dev/stdin")
+           | views::transform([](const Edge& e) { return std::pair{e.dst, e.src}; })
+           | ranges::to<std::unordered_map>();
+  })};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(parents); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(parents); })};
 
   std::println("{} {}", part1, part2);
 
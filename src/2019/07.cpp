@@ -47,10 +47,16 @@ auto run(const auto& program, ranges::input_range auto&& phase_set, Mode mode) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto part1{run(program, views::iota(0, 5), Mode::stateless)};
-  const auto part2{run(program, views::iota(5, 10), Mode::stateful)};
+  const auto part1{aoc::timed("part1", [&] {
+    return run(program, views::iota(0, 5), Mode::stateless);
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return run(program, views::iota(5, 10), Mode::stateful);
+  })};
 
   std::println("{} {}", part1, part2);
 
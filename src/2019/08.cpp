@@ -48,10 +48,10 @@ auto parse_layers(const std::string path) {
 }
 
 int main() {
-  const auto layers{parse_layers("/dev/stdin")};
+  const auto layers{aoc::timed("parse", [] { return parse_layers("/dev/stdin"); })};
 
-  const auto part1{find_part1(layers)};
-  const auto part2{find_part2(layers)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(layers); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(layers); })};
 
   std::println("{} {}", part1, part2);
 
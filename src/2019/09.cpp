@@ -11,10 +11,12 @@ auto run(const auto& program, const int input) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto part1{run(program, 1)};
-  const auto part2{run(program, 2)};
+  const auto part1{aoc::timed("part1", [&] { return run(program, 1); })};
+  const auto part2{aoc::timed("part2", [&] { return run(program, 2); })};
 
   std::println("{} {}", part1, part2);
 
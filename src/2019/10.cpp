@@ -79,7 +79,10 @@ Points parse_asteroids(std::string_view path) {
   return asteroids;
 }
 int main() {
-  const auto [part1, part2]{search(parse_asteroids("/dev/stdin"))};
+  auto asteroids{aoc::timed("parse", [] { return parse_asteroids("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(std::move(asteroids));
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
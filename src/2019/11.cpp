@@ -70,13 +70,14 @@ std::string parse_identifier(const Tiles& tiles) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto tiles1{paint(Tiles{}, program)};
-  const auto part1{tiles1.size()};
-
-  const auto tiles2{paint(Tiles{{Vec2(), Tile::white}}, program)};
-  const auto part2{parse_identifier(tiles2)};
+  const auto part1{aoc::timed("part1", [&] { return paint(Tiles{}, program).size(); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return parse_identifier(paint(Tiles{{Vec2(), Tile::white}}, program));
+  })};
 
   std::println("{} {}", part1, part2);
 
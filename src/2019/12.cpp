@@ -91,7 +91,10 @@ Moons parse_system(const std::string path) {
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_system("/dev/stdin"))};
+  auto moons{aoc::timed("parse", [] { return parse_system("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(std::move(moons));
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
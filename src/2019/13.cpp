@@ -47,10 +47,12 @@ auto find_part2(const auto& program) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto part1{find_part1(program)};
-  const auto part2{find_part2(program)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(program); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(program); })};
 
   std::println("{} {}", part1, part2);
 
@@ -93,10 +93,10 @@ auto parse_input(const std::string path) {
 }
 
 int main() {
-  const auto recipes{parse_input("/dev/stdin")};
+  const auto recipes{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(recipes)};
-  const auto part2{find_part2(recipes)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(recipes); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(recipes); })};
 
   std::println("{} {}", part1, part2);
 
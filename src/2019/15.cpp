@@ -29,7 +29,7 @@ auto explore(const auto& program) {
         continue;
       }
 
-      IntCode droid(droid_prev);
+      IntCode droid{droid_prev.fork()};
       droid.input.push_back(cmd);
       switch (droid.run_until_output().value()) {
         case 2: {
@@ -73,10 +73,12 @@ auto flood_fill(Vec2 oxygen, const auto& tiles) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
   const auto [part1, oxygen, tiles]{explore(program)};
-  const auto part2{flood_fill(oxygen, tiles)};
+  const auto part2{aoc::timed("part2", [&] { return flood_fill(oxygen, tiles); })};
 
   std::println("{} {}", part1, part2);
 
@@ -12,38 +12,80 @@ auto take_prefix(const auto& v, std::size_t n) {
   );
 }
 
+constexpr auto n_phases{100};
+
 auto find_part1(auto v) {
-  const std::array pattern{0, 1, 0, -1};
-  for (int phase{}; phase < 100; ++phase) {
-    for (auto i{0UZ}; i < v.size(); ++i) {
+  const auto n{v.size()};
+  std::vector<long> prefix(n + 1);
+  const auto run_sum{[&](std::size_t first, std::size_t last) {
+    return prefix[std::min(last, n)] - prefix[std::min(first, n)];
+  }};
+  for (int phase{}; phase < n_phases; ++phase) {
+    std::inclusive_scan(v.begin(), v.end(), prefix.begin() + 1, std::plus{}, 0L);
+    for (auto i{0UZ}; i < n; ++i) {
+      // output i repeats each pattern element i + 1 times, which makes the pattern a sequence of
+      // runs of +1 starting at i, i + 4 (i + 1), ... and runs of -1 two runs later
+      const auto len{i + 1};
       long out{};
-      for (auto j{0UZ}; j < v.size(); ++j) {
-        const auto k{((j + 1) / (i + 1)) % pattern.size()};
-        out += v[j] * pattern.at(k);
+      for (auto first{i}; first < n; first += 4 * len) {
+        out += run_sum(first, first + len) - run_sum(first + 2 * len, first + 3 * len);
       }
+      // v[j] for j < i is no longer needed, since the pattern for output i starts with zeros
       v[i] = std::abs(out) % 10;
     }
   }
   return take_prefix(v, 8);
 }
 
-auto find_part2(const auto& input) {
-  std::vector<long> v;
-  {
-    const auto n{input.size()};
-    const auto offset{take_prefix(input, 7)};
-    v.append_range(views::drop(input, offset % n));
-    for (int rep{}; rep < (10'000 * n - offset) / n; ++rep) {
-      v.append_range(input);
+// Binomial coefficient n over k modulo a small prime p, by Lucas' theorem
+constexpr int binomial_mod_prime(long n, long k, const long p) {
+  long res{1};
+  for (; k > 0 and res > 0; n /= p, k /= p) {
+    const auto nd{n % p};
+    const auto kd{k % p};
+    long c{1};
+    for (long i{}; i < kd; ++i) {
+      c = c * (nd - i) / (i + 1);
     }
+    res = res * c % p;
   }
-  for (int phase{}; phase < 100; ++phase) {
-    long out{};
-    for (auto& x : views::reverse(v)) {
-      x = (out += x) % 10;
+  return static_cast<int>(res);
+}
+
+constexpr std::int8_t binomial_mod_10(long n, long k) {
+  // chinese remainder theorem, 5 = 1 (mod 2) and 6 = 1 (mod 5)
+  return (5 * binomial_mod_prime(n, k, 2) + 6 * binomial_mod_prime(n, k, 5)) % 10;
+}
+
+auto find_part2(const auto& input) {
+  const auto n{input.size()};
+  const auto offset{take_prefix(input, 7)};
+  if (offset < 10'000 * n / 2 or offset >= 10'000 * n) {
+    throw std::runtime_error("message offset must be in the second half of the signal");
+  }
+  const auto tail{
+      views::iota(offset, 10'000 * n)
+      | views::transform([&](auto i) -> std::int8_t { return input[i % n]; })
+      | ranges::to<std::vector>()
+  };
+  // The offset is in the second half of the signal, where each phase replaces every digit with
+  // the suffix sum starting at it.
+  // After all phases, digit i is the sum of tail[i + k] weighted by the number of ways of
+  // choosing k in n_phases steps, which is the binomial coefficient k + n_phases - 1 over k.
+  const auto weights{
+      views::iota(0UZ, tail.size())
+      | views::transform([](auto k) { return binomial_mod_10(k + n_phases - 1, n_phases - 1); })
+      | ranges::to<std::vector>()
+  };
+  std::vector<int> digits;
+  for (auto i{0UZ}; i < 8; ++i) {
+    int out{};
+    for (auto k{0UZ}; k + i < tail.size(); ++k) {
+      out += weights[k] * tail[i + k];
     }
+    digits.push_back(out % 10);
   }
-  return take_prefix(v, 8);
+  return take_prefix(digits, 8);
 }
 
 auto parse_input(const std::string path) {
@@ -64,10 +106,10 @@ auto parse_input(const std::string path) {
 }
 
 int main() {
-  const auto input{parse_input("/dev/stdin")};
+  const auto input{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(input)};
-  const auto part2{find_part2(input)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(input); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(input); })};
 
   std::println("{} {}", part1, part2);
 
@@ -222,11 +222,13 @@ auto init_part2(Maze m, Vec2 entrance) {
 }
 
 int main() {
-  auto [maze1, entrance1]{parse_maze("/dev/stdin")};
+  auto [maze1, entrance1]{aoc::timed("parse", [] { return parse_maze("/dev/stdin"); })};
   auto [maze2, entrances2]{init_part2(maze1, entrance1)};
 
-  const auto part1{collect_keys(maze1, std::vector{entrance1})};
-  const auto part2{collect_keys(maze2, entrances2)};
+  const auto part1{aoc::timed("part1", [&] {
+    return collect_keys(maze1, std::vector{entrance1});
+  })};
+  const auto part2{aoc::timed("part2", [&] { return collect_keys(maze2, entrances2); })};
 
   std::println("{} {}", part1, part2);
 
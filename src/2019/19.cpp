@@ -10,8 +10,9 @@ using intcode::IntCode;
 constexpr auto sum{std::bind_back(ranges::fold_left, 0L, std::plus{})};
 
 auto search(const auto& program) {
-  const auto is_pulled{[&program](int y, int x) {
-    IntCode ic(program);
+  const IntCode drone(program);
+  const auto is_pulled{[&drone](int y, int x) {
+    IntCode ic{drone.fork()};
     ic.input.push_back(x);
     ic.input.push_back(y);
     return ic.run_until_output().value();
@@ -35,8 +36,10 @@ auto search(const auto& program) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
-  const auto [part1, part2]{search(program)};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(program); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -173,10 +173,10 @@ Graph parse_input(std::string_view path) {
 }
 
 int main() {
-  const Graph graph{parse_input("/dev/stdin")};
+  const Graph graph{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{search(graph, Search::simple)};
-  const auto part2{search(graph, Search::recursive)};
+  const auto part1{aoc::timed("part1", [&] { return search(graph, Search::simple); })};
+  const auto part2{aoc::timed("part2", [&] { return search(graph, Search::recursive); })};
 
   std::println("{} {}", part1, part2);
 
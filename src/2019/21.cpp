@@ -23,32 +23,38 @@ auto run_script(const auto& program, auto&& script) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
 
-  const auto part1{run_script(
-      program,
-      std::vector{
-          "NOT C T"s,
-          "AND D T"s,
-          "OR T J"s,
-          "NOT A T"s,
-          "OR T J"s,
-          "WALK"s,
-      }
-  )};
-  const auto part2{run_script(
-      program,
-      std::vector{
-          "NOT B J"s,
-          "NOT C T"s,
-          "OR T J"s,
-          "AND H J"s,
-          "NOT A T"s,
-          "OR T J"s,
-          "AND D J"s,
-          "RUN"s,
-      }
-  )};
+  const auto part1{aoc::timed("part1", [&] {
+    return run_script(
+        program,
+        std::vector{
+            "NOT C T"s,
+            "AND D T"s,
+            "OR T J"s,
+            "NOT A T"s,
+            "OR T J"s,
+            "WALK"s,
+        }
+    );
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return run_script(
+        program,
+        std::vector{
+            "NOT B J"s,
+            "NOT C T"s,
+            "OR T J"s,
+            "AND H J"s,
+            "NOT A T"s,
+            "OR T J"s,
+            "AND D J"s,
+            "RUN"s,
+        }
+    );
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -148,10 +148,10 @@ std::istream& operator>>(std::istream& is, Shuffle& s) {
 }
 
 int main() {
-  const auto shuffles{aoc::parse_items<Shuffle>("/dev/stdin")};
+  const auto shuffles{aoc::timed("parse", [] { return aoc::parse_items<Shuffle>("/dev/stdin"); })};
 
-  const auto part1{find_part1(shuffles)};
-  const auto part2{find_part2(shuffles)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(shuffles); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(shuffles); })};
 
   std::println("{} {}", part1, part2);
 
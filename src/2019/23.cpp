@@ -7,76 +7,71 @@ namespace views = std::views;
 
 using intcode::IntCode;
 
-struct NAT {
+struct Packet {
   long x{};
   long y{};
-  long dst{};
 };
 
-struct NIC {
-  IntCode ic;
-  bool idle{};
-
-  void push(auto... inputs) {
-    (ic.input.push_back(inputs), ...);
+auto run(const auto& program) {
+  intcode::Network net(views::repeat(IntCode(program), 50) | ranges::to<std::vector>());
+  for (auto i{0UZ}; i < net.size(); ++i) {
+    net.send(i, i);
   }
-};
 
-std::optional<NAT> run_step(auto& nats, NIC& nic) {
-  if (nic.ic.input.empty()) {
-    nic.push(-1);
-    nic.idle = true;
-  } else {
-    nic.idle = false;
-  }
-  nic.ic.run_while_input();
-  if (nic.ic.output.empty()) {
-    return {};
-  }
-  auto dst{nic.ic.pop_output().value()};
-  auto x{nic.ic.pop_output().value()};
-  auto y{nic.ic.pop_output().value()};
-  if (0 <= dst and dst < 50) {
-    return NAT{x, y, dst};
-  }
-  if (dst == 255) {
-    nats.back() = {x, y, dst};
-    return {};
-  }
-  throw std::runtime_error(std::format("bad dst {}", dst));
-}
+  std::optional<long> part1;
+  std::optional<Packet> nat;
+  std::optional<long> prev_nat_y;
 
-auto run(auto nics) {
-  for (std::vector<NAT> nats{{}};;) {
-    for (NIC& nic : nics) {
-      if (auto dst_nat{run_step(nats, nic)}) {
-        nics.at(dst_nat->dst).push(dst_nat->x, dst_nat->y);
+  const auto route_packets{[&](IntCode& ic) {
+    const bool sent{not ic.output.empty()};
+    while (ic.output.size() >= 3) {
+      auto dst{ic.pop_output().value()};
+      auto x{ic.pop_output().value()};
+      auto y{ic.pop_output().value()};
+      if (dst == 255) {
+        nat = {x, y};
+        part1 = part1.value_or(y);
+      } else if (0 <= dst and std::cmp_less(dst, net.size())) {
+        net.send(dst, x, y);
+      } else {
+        throw std::runtime_error(std::format("bad dst {}", dst));
       }
     }
-    if (ranges::all_of(nics, &NIC::idle)) {
-      auto nat{nats.rbegin()};
-      nics[0].push(nat->x, nat->y);
-      if (nat->dst) {
-        if (nats.size() > 1 and nat->y == (nat + 1)->y) {
-          return std::pair{nats.front().y, nats.back().y};
-        }
-        nats.emplace_back();
+    return sent;
+  }};
+
+  for (;;) {
+    while (auto i{net.run_next()}) {
+      route_packets(net.at(i.value()));
+    }
+
+    // no packets in flight, let every NIC poll its empty queue once
+    bool sent{false};
+    for (auto i{0UZ}; i < net.size(); ++i) {
+      auto& ic{net.at(i)};
+      ic.input.push_back(-1);
+      ic.run_until_blocked();
+      sent = route_packets(ic) or sent;
+    }
+
+    if (not sent and net.is_idle()) {
+      if (not nat) {
+        throw std::runtime_error("network is idle but NAT has no packet");
+      }
+      if (prev_nat_y == nat->y) {
+        return std::pair{part1.value(), nat->y};
       }
+      prev_nat_y = nat->y;
+      net.send(0, nat->x, nat->y);
     }
   }
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
-  const auto nics{
-      views::iota(0, 50) | views::transform([&program](auto i) {
-        NIC nic{.ic = IntCode(program), .idle = false};
-        nic.push(i);
-        return nic;
-      })
-      | ranges::to<std::vector>()
-  };
-  const auto [part1, part2]{run(nics)};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return run(program); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -1,151 +1,110 @@
 #include "aoc.hpp"
-#include "ndvec.hpp"
+#include "cellular.hpp"
 #include "std.hpp"
 
-namespace ranges = std::ranges;
-namespace views = std::views;
+// 5x5 tiles of one level, tile (x, y) is bit 5 * y + x
+using cellular::Word;
+using Counts = cellular::Counts<4>;
 
-using Vec3 = ndvec::vec3<long>;
+constexpr Word all_tiles{(Word{1} << 25) - 1};
+constexpr Word center{Word{1} << 12};
 
-struct Grid {
-  std::unordered_set<Vec3> bugs;
-
-  [[nodiscard]]
-  auto count_bugs(ranges::range auto&& points) const {
-    return ranges::count_if(points, [&](Vec3 p) { return bugs.contains(p); });
-  }
-
-  [[nodiscard]]
-  static bool in_grid(Vec3 p) {
-    return 0 <= p.y() and p.y() < 5 and 0 <= p.x() and p.x() < 5;
-  }
-
-  bool operator==(const Grid&) const = default;
-};
-
-constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
+constexpr Word row(int y) {
+  return Word{0b11111} << (5 * y);
+}
 
-std::vector<Vec3> get_adjacent(const Vec3& p) {
-  return {
-      p - Vec3(1, 0, 0),
-      p - Vec3(0, 1, 0),
-      p + Vec3(1, 0, 0),
-      p + Vec3(0, 1, 0),
-  };
+constexpr Word column(int x) {
+  return Word{0b100001000010000100001} << x;
 }
 
-auto find_part1(Grid g) {
-  for (std::vector<Grid> seen; ranges::find(seen, g) == seen.end();) {
-    seen.push_back(g);
-    Grid g2{g};
-    for (Vec3 bug : g.bugs) {
-      const auto adjacent{get_adjacent(bug)};
-      if (g.count_bugs(adjacent) != 1) {
-        g2.bugs.erase(bug);
-      }
-      for (Vec3 p : adjacent) {
-        if (Grid::in_grid(p) and not g.bugs.contains(p)) {
-          if (auto n{g.count_bugs(get_adjacent(p))}; n == 1 or n == 2) {
-            g2.bugs.insert(p);
-          }
-        }
-      }
-    }
-    g = g2;
-  }
-  return sum(views::transform(views::iota(0, 25), [&g](long i) {
-    auto [y, x]{std::ldiv(i, 5L)};
-    return g.bugs.contains(Vec3(x, y, 0)) ? (1 << i) : 0;
-  }));
+// Tiles next to the center and the edge of the inner level they touch
+constexpr std::array<std::pair<int, Word>, 4> edges_around_center{{
+    {7, row(0)},
+    {11, column(0)},
+    {13, column(4)},
+    {17, row(4)},
+}};
+
+// Bugs on the tiles above, below, left and right of every tile in the same level
+Counts count_adjacent(Word bugs) {
+  Counts n;
+  n.add((bugs << 1) & ~column(0));
+  n.add((bugs >> 1) & ~column(4));
+  n.add((bugs << 5) & all_tiles);
+  n.add(bugs >> 5);
+  return n;
 }
 
-auto get_adjacent_x(const Vec3& p) {
-  std::vector<Vec3> adj;
-  if (p.x() == 0) {
-    adj.push_back(p + Vec3(1, 0, 0));
-    adj.emplace_back(1, 2, p.z() + 1);
-  } else if (p.x() == 4) {
-    adj.push_back(p - Vec3(1, 0, 0));
-    adj.emplace_back(3, 2, p.z() + 1);
-  } else if (p.y() != 2) {
-    adj.push_back(p - Vec3(1, 0, 0));
-    adj.push_back(p + Vec3(1, 0, 0));
-  } else if (p.x() == 1) {
-    adj.push_back(p - Vec3(1, 0, 0));
-    for (Vec3 q(0, 0, p.z() - 1); q.y() < 5; q.y() += 1) {
-      adj.push_back(q);
-    }
-  } else if (p.x() == 3) {
-    adj.push_back(p + Vec3(1, 0, 0));
-    for (Vec3 q(4, 0, p.z() - 1); q.y() < 5; q.y() += 1) {
-      adj.push_back(q);
-    }
-  } else {
-    throw std::runtime_error(std::format("unhandled point {}", p));
-  }
-  return adj;
+Word next_generation(Word bugs, const Counts& n) {
+  return ((bugs & n.equals(1)) | (~bugs & (n.equals(1) | n.equals(2)))) & all_tiles;
 }
 
-auto get_adjacent_recursive(const Vec3& p) {
-  const auto adj_x{get_adjacent_x(p)};
-  const auto adj_y{get_adjacent_x(Vec3(p.y(), p.x(), p.z()))};
-  std::vector<Vec3> adj;
-  adj.append_range(adj_x);
-  adj.append_range(views::transform(adj_y, [](Vec3 p) { return Vec3(p.y(), p.x(), p.z()); }));
-  return adj;
+auto find_part1(Word bugs) {
+  for (std::unordered_set<Word> seen; seen.insert(bugs).second;) {
+    bugs = next_generation(bugs, count_adjacent(bugs));
+  }
+  return bugs;
 }
 
-auto find_part2(Grid g) {
-  for (int i{}; i < 200; ++i) {
-    Grid g2{g};
-    for (Vec3 bug : g.bugs) {
-      const auto adjacent{get_adjacent_recursive(bug)};
-      if (g.count_bugs(adjacent) != 1) {
-        g2.bugs.erase(bug);
+auto find_part2(Word bugs) {
+  constexpr int n_minutes{200};
+  // each minute can spread bugs one level further out and in
+  std::vector<Word> levels(2 * n_minutes + 3);
+  levels[n_minutes + 1] = bugs & ~center;
+  for (int i{}; i < n_minutes; ++i) {
+    std::vector<Word> after(levels.size());
+    for (auto z{1UZ}; z + 1 < levels.size(); ++z) {
+      auto n{count_adjacent(levels[z])};
+      // the tiles around the center of the outer level touch whole edges of this level
+      const auto outer{levels[z - 1]};
+      for (auto [tile, edge] : edges_around_center) {
+        if ((outer >> tile) & 1U) {
+          n.add(edge);
+        }
       }
-      for (Vec3 p : adjacent) {
-        if (p != Vec3(2, 2, 0) and not g.bugs.contains(p)) {
-          if (auto n{g.count_bugs(get_adjacent_recursive(p))}; n == 1 or n == 2) {
-            g2.bugs.insert(p);
-          }
+      // and the edges of the inner level touch the tiles around the center of this level
+      const auto inner{levels[z + 1]};
+      for (auto [tile, edge] : edges_around_center) {
+        for (int k{}; k < std::popcount(inner & edge); ++k) {
+          n.add(Word{1} << tile);
         }
       }
+      after[z] = next_generation(levels[z], n) & ~center;
     }
-    g = g2;
+    levels = std::move(after);
   }
-  return g.bugs.size();
+  return std::ranges::fold_left(levels, 0, [](int n, Word w) { return n + std::popcount(w); });
 }
 
-Grid parse_grid(std::string_view path) {
-  Grid g;
+Word parse_grid(std::string_view path) {
+  Word bugs{};
 
   std::istringstream is{aoc::slurp_file(path)};
   {
-    Vec3 pos;
-    for (std::string line; std::getline(is, line) and line.size() == 5; pos.y() += 1) {
-      pos.x() = 0;
+    int i{};
+    for (std::string line; std::getline(is, line) and line.size() == 5;) {
       for (char ch : line) {
         if (ch == '#') {
-          g.bugs.insert(pos);
+          bugs |= Word{1} << i;
         } else if (ch != '.') {
           throw std::runtime_error("every char must be # or .");
         }
-        pos.x() += 1;
+        i += 1;
       }
     }
   }
 
   if (is.eof()) {
-    return g;
+    return bugs;
   }
   throw std::runtime_error("invalid input, parsing failed");
 }
 
 int main() {
-  const Grid grid{parse_grid("/dev/stdin")};
+  const auto bugs{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{find_part1(grid)};
-  const auto part2{find_part2(grid)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(bugs); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(bugs); })};
 
   std::println("{} {}", part1, part2);
 
@@ -201,8 +201,10 @@ auto explore(const auto& program) {
 }
 
 int main() {
-  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
-  const auto part1{explore(program)};
+  const auto program{aoc::timed("parse", [] {
+    return intcode::parse_program(aoc::slurp_file("/dev/stdin"));
+  })};
+  const auto part1{aoc::timed("part1", [&] { return explore(program); })};
   std::print("{}\n", part1);
   return 0;
 }
@@ -32,12 +32,16 @@ std::istream& operator>>(std::istream& is, Item& item) {
 }
 
 int main() {
+  const auto items{aoc::timed("parse", [] { return aoc::parse_items<Item>("/dev/stdin"); })};
   int part1{};
   int part2{};
-  for (auto&& [min_n, max_n, ch, password] : aoc::parse_items<Item>("/dev/stdin")) {
-    const auto n_required{ranges::count(password, ch)};
-    part1 += int{min_n <= n_required and n_required <= max_n};
-    part2 += int{(password.at(min_n - 1) == ch) != (password.at(max_n - 1) == ch)};
+  {
+    const aoc::ScopeTimer timer{"part1 and part2"};
+    for (const auto& [min_n, max_n, ch, password] : items) {
+      const auto n_required{ranges::count(password, ch)};
+      part1 += int{min_n <= n_required and n_required <= max_n};
+      part2 += int{(password.at(min_n - 1) == ch) != (password.at(max_n - 1) == ch)};
+    }
   }
   std::println("{} {}", part1, part2);
   return 0;
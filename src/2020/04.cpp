@@ -82,9 +82,9 @@ bool is_valid(const Passport& p) {
 }
 
 int main() {
-  const Passports ps{parse_passports("/dev/stdin")};
-  const auto part1{ranges::count_if(ps, is_filled)};
-  const auto part2{ranges::count_if(ps, is_valid)};
+  const Passports ps{aoc::timed("parse", [] { return parse_passports("/dev/stdin"); })};
+  const auto part1{aoc::timed("part1", [&] { return ranges::count_if(ps, is_filled); })};
+  const auto part2{aoc::timed("part2", [&] { return ranges::count_if(ps, is_valid); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
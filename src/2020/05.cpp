@@ -41,7 +41,8 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_input("/dev/stdin"))};
+  const auto ids{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(ids); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -37,7 +37,7 @@ auto search(std::string_view path) {
 }
 
 int main() {
-  const auto [part1, part2]{search("/dev/stdin")};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search("/dev/stdin"); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -90,10 +90,10 @@ std::istream& operator>>(std::istream& is, Rule& rule) {
 }
 
 int main() {
-  const auto rules{aoc::parse_items<Rule>("/dev/stdin")};
+  const auto rules{aoc::timed("parse", [] { return aoc::parse_items<Rule>("/dev/stdin"); })};
 
-  const auto part1{find_part1(rules)};
-  const auto part2{find_part2(rules)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(rules); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(rules); })};
 
   std::println("{} {}", part1, part2);
 
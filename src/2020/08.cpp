@@ -81,10 +81,12 @@ std::istream& operator>>(std::istream& is, Instruction& ins) {
 }
 
 int main() {
-  const auto program{aoc::parse_items<Instruction>("/dev/stdin")};
+  const auto program{aoc::timed("parse", [] {
+    return aoc::parse_items<Instruction>("/dev/stdin");
+  })};
 
-  const auto part1{find_part1(program)};
-  const auto part2{find_part2(program)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(program); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(program); })};
 
   std::println("{} {}", part1, part2);
 
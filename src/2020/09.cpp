@@ -38,7 +38,8 @@ auto search(const auto& v) {
 }
 
 int main() {
-  const auto [part1, part2]{search(aoc::parse_items<long>("/dev/stdin"))};
+  const auto numbers{aoc::timed("parse", [] { return aoc::parse_items<long>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(numbers); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -30,7 +30,10 @@ auto search(auto jolts) {
 }
 
 int main() {
-  const auto [part1, part2]{search(aoc::parse_items<int>("/dev/stdin"))};
+  auto jolts{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(std::move(jolts));
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
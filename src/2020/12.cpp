@@ -127,10 +127,10 @@ std::istream& operator>>(std::istream& is, Action& action) {
 }
 
 int main() {
-  const auto actions{aoc::parse_items<Action>("/dev/stdin")};
+  const auto actions{aoc::timed("parse", [] { return aoc::parse_items<Action>("/dev/stdin"); })};
 
-  const auto part1{find_part1(actions)};
-  const auto part2{find_part2(actions)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(actions); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(actions); })};
 
   std::println("{} {}", part1, part2);
 
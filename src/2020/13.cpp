@@ -73,10 +73,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [earliest, ids]{parse_input("/dev/stdin")};
+  const auto [earliest, ids]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(earliest, ids)};
-  const auto part2{find_part2(ids)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(earliest, ids); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(ids); })};
 
   std::println("{} {}", part1, part2);
 
@@ -142,10 +142,12 @@ std::istream& operator>>(std::istream& is, Instruction& ins) {
 }
 
 int main() {
-  const auto instructions{aoc::parse_items<Instruction>("/dev/stdin")};
+  const auto instructions{aoc::timed("parse", [] {
+    return aoc::parse_items<Instruction>("/dev/stdin");
+  })};
 
-  const auto part1{find_part1(instructions)};
-  const auto part2{find_part2(instructions)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(instructions); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(instructions); })};
 
   std::println("{} {}", part1, part2);
 
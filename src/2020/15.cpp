@@ -1,29 +1,52 @@
-// TODO slow
 #include "aoc.hpp"
-#include "my_std.hpp"
 #include "std.hpp"
 
-auto search(const auto& items, const int n) {
-  std::unordered_map<int, int> age1;
-  std::unordered_map<int, int> age2;
-  for (auto [t, x] : my_std::views::enumerate(items, 1)) {
-    age1[x] = age2[x] = t;
-  }
-  int t0{items.back()};
-  for (auto t1{items.size() + 1}; t1 <= n; ++t1) {
-    t0 = age2[t0] - age1[t0];
-    if ((age1[t0] = std::exchange(age2[t0], t1)) == 0) {
-      age1[t0] = t1;
+namespace ranges = std::ranges;
+
+// Number spoken on turn n of the game starting with items, the number of simulated turns is added
+// to counter.
+// The turn on which each number was last spoken is kept in a flat array indexed by the number.
+// Numbers from hot_limit upwards are rare and most of them are spoken only once, so a bitmap of
+// the numbers already spoken, 32 times smaller than the array, answers most lookups of large
+// numbers without a cache miss.
+auto search(const auto& items, const std::uint32_t n, std::string_view counter) {
+  constexpr std::uint32_t hot_limit{1U << 16};
+
+  const auto size{std::max(n, static_cast<std::uint32_t>(ranges::max(items)) + 1)};
+  std::vector<std::uint32_t> last_turn(size);
+  std::vector<std::uint64_t> spoken((size + 63) / 64);
+
+  const auto speak{[&](const std::uint32_t x, const std::uint32_t turn) -> std::uint32_t {
+    if (x >= hot_limit) {
+      auto& word{spoken[x / 64]};
+      const auto bit{1UZ << (x % 64)};
+      if ((word & bit) == 0) {
+        word |= bit;
+        last_turn[x] = turn;
+        return 0;
+      }
     }
+    const auto prev{std::exchange(last_turn[x], turn)};
+    return prev == 0 ? 0 : turn - prev;
+  }};
+
+  std::uint32_t turn{1};
+  for (const auto x : items | std::views::take(items.size() - 1)) {
+    speak(x, turn++);
+  }
+  auto x{static_cast<std::uint32_t>(items.back())};
+  for (; turn < n; ++turn) {
+    x = speak(x, turn);
   }
-  return t0;
+  aoc::count(counter, turn - 1);
+  return x;
 }
 
 int main() {
-  const auto items{aoc::parse_items<int>("/dev/stdin", ',')};
+  const auto items{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin", ','); })};
 
-  const auto part1{search(items, 2020)};
-  const auto part2{search(items, 30'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return search(items, 2020, "part1 turns"); })};
+  const auto part2{aoc::timed("part2", [&] { return search(items, 30'000'000, "part2 turns"); })};
 
   std::println("{} {}", part1, part2);
 
@@ -174,8 +174,12 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [rules, my_ticket, tickets]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(rules, my_ticket, tickets)};
+  const auto [rules, my_ticket, tickets]{aoc::timed("parse", [] {
+    return parse_input("/dev/stdin");
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(rules, my_ticket, tickets);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
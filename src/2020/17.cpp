@@ -1,88 +1,58 @@
 #include "aoc.hpp"
-#include "ndvec.hpp"
+#include "cellular.hpp"
 #include "std.hpp"
 
-using Vec4 = ndvec::vec4<int>;
+using Slice = std::vector<std::array<int, 2>>;
 
-auto get_adjacent(Vec4 p, bool dim4) {
-  std::vector<Vec4> adj;
-  for (Vec4 d(-1, -1, -1, -int{dim4}); d.w() <= int{dim4}; d.w() += 1) {
-    for (d.z() = -1; d.z() <= 1; d.z() += 1) {
-      for (d.y() = -1; d.y() <= 1; d.y() += 1) {
-        for (d.x() = -1; d.x() <= 1; d.x() += 1) {
-          if (d != Vec4()) {
-            adj.push_back(p + d);
-          }
-        }
-      }
-    }
-  }
-  return adj;
-}
-
-struct Grid {
-  std::unordered_set<Vec4> active;
-  std::size_t width{};
+template <std::size_t N>
+auto simulate(const Slice& active, const std::array<int, 2>& size, auto n_cycles) {
+  using Board = cellular::Board<N>;
 
-  [[nodiscard]]
-  auto count_active(const auto& positions) const {
-    return std::ranges::count_if(positions, [this](Vec4 p) { return active.contains(p); });
-  }
+  typename Board::Index shape{};
+  shape.fill(1);
+  shape[0] = size[0];
+  shape[1] = size[1];
 
-  [[nodiscard]]
-  Grid step(bool dim4) const {
-    Grid out{*this};
-    for (const Vec4& p : active) {
-      const auto adjacent{get_adjacent(p, dim4)};
-      if (auto n{count_active(adjacent)}; n != 2 and n != 3) {
-        out.active.erase(p);
-      }
-      for (const Vec4& adj : adjacent) {
-        if (not active.contains(adj)) {
-          if (auto n{count_active(get_adjacent(adj, dim4))}; n == 3) {
-            out.active.insert(adj);
-          }
-        }
-      }
-    }
-    return out;
+  Board board(shape);
+  for (auto [x, y] : active) {
+    typename Board::Index p{};
+    p[0] = x;
+    p[1] = y;
+    board.set(p);
   }
-};
-
-auto simulate(Grid grid, auto n_cycles, bool dim4) {
   for (int c{}; c < n_cycles; ++c) {
-    grid = grid.step(dim4);
+    board = cellular::step(board.grown(1), cellular::conway<cellular::moore_bits(N)>);
   }
-  return grid.active.size();
+  return board.count();
 }
 
-Grid parse_grid(std::string_view path) {
-  Grid g;
-  for (Vec4 pos; const std::string& line : aoc::slurp_lines(path)) {
-    if (g.width == 0) {
-      g.width = line.size();
-    } else if (line.size() != g.width) {
+auto parse_slice(std::string_view path) {
+  Slice active;
+  std::array<int, 2> size{};
+  for (const std::string& line : aoc::slurp_lines(path)) {
+    if (size[1] == 0) {
+      size[0] = static_cast<int>(line.size());
+    } else if (static_cast<int>(line.size()) != size[0]) {
       throw std::runtime_error("every row must be of same width");
     }
-    pos.x() = 0;
-    for (char ch : line) {
+    for (int x{}; char ch : line) {
       if (ch == '#') {
-        g.active.insert(pos);
+        active.push_back({x, size[1]});
       } else if (ch != '.') {
         throw std::runtime_error(std::format("invalid tile '{}', must be # or .", ch));
       }
-      pos.x() += 1;
+      x += 1;
     }
-    pos.y() += 1;
+    size[1] += 1;
   }
-  return g;
+  return std::pair{active, size};
 }
 
 int main() {
-  const Grid grid{parse_grid("/dev/stdin")};
+  const auto [active, size]{aoc::timed("parse", [] { return parse_slice("/dev/stdin"); })};
 
-  const auto part1{simulate(grid, 6, false)};
-  const auto part2{simulate(grid, 6, true)};
+  const auto part1{aoc::timed("part1", [&] { return simulate<3>(active, size, 6); })};
+  const auto part2{aoc::timed("part2", [&] { return simulate<4>(active, size, 6); })};
 
   std::println("{} {}", part1, part2);
 
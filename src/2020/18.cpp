@@ -86,8 +86,8 @@ auto compute(const auto& expressions, bool equal_precedence) {
 int main() {
   const auto expressions{aoc::slurp_lines("/dev/stdin")};
 
-  const auto part1{compute(expressions, true)};
-  const auto part2{compute(expressions, false)};
+  const auto part1{aoc::timed("part1", [&] { return compute(expressions, true); })};
+  const auto part2{aoc::timed("part2", [&] { return compute(expressions, false); })};
 
   std::println("{} {}", part1, part2);
 
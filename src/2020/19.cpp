@@ -129,8 +129,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [statements, input]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(statements, input)};
+  const auto [statements, input]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(statements, input);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -281,12 +281,12 @@ std::istream& operator>>(std::istream& is, Tile& tile) {
 }
 
 int main() {
-  const auto tiles{aoc::parse_items<Tile>("/dev/stdin")};
+  const auto tiles{aoc::timed("parse", [] { return aoc::parse_items<Tile>("/dev/stdin"); })};
   const auto tilemap{
       tiles | views::transform([](Tile t) { return std::pair{t.id, t}; })
       | ranges::to<std::unordered_map<int, Tile>>()
   };
-  const auto [part1, part2]{search(tilemap)};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(tilemap); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
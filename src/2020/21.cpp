@@ -138,8 +138,8 @@ auto search(const Foods& foods) {
 }
 
 int main() {
-  const auto foods{aoc::parse_items<Food>("/dev/stdin")};
-  const auto [part1, part2]{search(foods)};
+  const auto foods{aoc::timed("parse", [] { return aoc::parse_items<Food>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(foods); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
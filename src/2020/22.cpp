@@ -88,10 +88,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [cards1, cards2]{parse_input("/dev/stdin")};
+  const auto [cards1, cards2]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{winner_score(cards1, cards2, false)};
-  const auto part2{winner_score(cards1, cards2, true)};
+  const auto part1{aoc::timed("part1", [&] { return winner_score(cards1, cards2, false); })};
+  const auto part2{aoc::timed("part2", [&] { return winner_score(cards1, cards2, true); })};
 
   std::println("{} {}", part1, part2);
 
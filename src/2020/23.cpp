@@ -4,55 +4,43 @@
 namespace ranges = std::ranges;
 namespace views = std::views;
 
+// Cups in clockwise order as an implicit linked list, next[c] is the label of the cup after cup c.
+// Labels go from 1 to size, next[0] is unused.
 struct Ring {
-  using List = std::list<long>;
-  using Iter = List::iterator;
-  List data;
-  Iter head;
-  std::unordered_map<List::value_type, Iter> nodes;
+  using Cup = std::uint32_t;
+  std::vector<Cup> next;
+  Cup head{};
 
-  Ring(const auto& values, const std::size_t size) : data(size) {
-    int i{};
-    for (auto pos{data.begin()}; pos != data.end(); ++pos, ++i) {
-      if (i < values.size()) {
-        *pos = values[i];
-      } else {
-        *pos = i + 1;
-      }
-      nodes[*pos] = pos;
+  Ring(const auto& values, const std::size_t size) : next(size + 1) {
+    const auto label{[&](const std::size_t i) -> Cup {
+      return i < values.size() ? values[i] : i + 1;
+    }};
+    head = label(0);
+    for (auto i{1UZ}; i < size; ++i) {
+      next[label(i - 1)] = label(i);
     }
-    head = data.begin();
-  }
-
-  auto next(auto it) {
-    ranges::advance(it, 1, data.end());
-    if (it == data.end()) {
-      it = data.begin();
-    }
-    return it;
+    next[label(size - 1)] = head;
   }
 
   void step() {
-    const auto cup1{*head};
-    {
-      const auto n{ranges::ssize(data)};
-      auto cup2{*head};
-      List pick;
-      for (auto it{next(head)}; pick.size() < 3;) {
-        pick.splice(pick.end(), data, std::exchange(it, next(it)));
-      }
-      while (cup1 == cup2 or ranges::contains(pick, cup2)) {
-        cup2 = (cup2 - 2 + n) % n + 1;
-      }
-      data.splice(next(nodes.at(cup2)), pick);
-    }
-    head = next(nodes.at(cup1));
+    const auto pick1{next[head]};
+    const auto pick2{next[pick1]};
+    const auto pick3{next[pick2]};
+    const auto n{static_cast<Cup>(next.size() - 1)};
+    auto dest{head};
+    do {
+      dest = dest == 1 ? n : dest - 1;
+    } while (dest == pick1 or dest == pick2 or dest == pick3);
+    next[head] = next[pick3];
+    next[pick3] = next[dest];
+    next[dest] = pick1;
+    head = next[head];
   }
 
-  auto to_str() {
+  auto to_str() const {
     std::ostringstream os;
-    for (auto it{next(nodes.at(1))}; *it != 1; it = next(it)) {
-      os << *it;
+    for (auto cup{next[1]}; cup != 1; cup = next[cup]) {
+      os << cup;
     }
     return os.str();
   }
@@ -71,10 +59,9 @@ auto find_part1(const auto& input) {
 }
 
 auto find_part2(const auto& input) {
-  Ring r{simulate(input, 1'000'000, 10'000'000)};
-  auto one{r.nodes.at(1)};
-  long long n1{*r.next(one)};
-  long long n2{*r.next(r.next(one))};
+  const Ring r{simulate(input, 1'000'000, 10'000'000)};
+  const long long n1{r.next[1]};
+  const long long n2{r.next[n1]};
   return n1 * n2;
 }
 
@@ -90,9 +77,9 @@ auto parse_digits(std::string_view path) {
 }
 
 int main() {
-  const auto input{parse_digits("/dev/stdin")};
-  const auto part1{find_part1(input)};
-  const auto part2{find_part2(input)};
+  const auto input{aoc::timed("parse", [] { return parse_digits("/dev/stdin"); })};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(input); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(input); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
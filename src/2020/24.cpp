@@ -121,8 +121,8 @@ auto parse_walks(std::string_view path) {
 }
 
 int main() {
-  const auto walks{parse_walks("/dev/stdin")};
-  const auto [part1, part2]{search(walks)};
+  const auto walks{aoc::timed("parse", [] { return parse_walks("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(walks); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
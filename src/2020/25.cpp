@@ -1,3 +1,4 @@
+#include "aoc.hpp"
 #include "std.hpp"
 
 long step(const long x, const long subject) {
@@ -28,7 +29,7 @@ auto search(const int card, const int door) {
 
 int main() {
   if (int card{}, door{}; std::cin >> card >> door) {
-    std::println("{}", search(card, door));
+    std::println("{}", aoc::timed("part1", [&] { return search(card, door); }));
     return 0;
   }
   throw std::runtime_error("failed parsing input, it should be a pair of integers");
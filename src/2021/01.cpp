@@ -27,9 +27,9 @@ auto find_part2(const auto& depths) {
 }
 
 int main() {
-  const auto depths{aoc::parse_items<int>("/dev/stdin")};
-  const auto part1{find_part1(depths)};
-  const auto part2{find_part2(depths)};
+  const auto depths{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(depths); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(depths); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -54,8 +54,8 @@ std::istream& operator>>(std::istream& is, Step& step) {
 }
 
 int main() {
-  const auto steps{aoc::parse_items<Step>("/dev/stdin")};
-  const auto [part1, part2]{search(steps)};
+  const auto steps{aoc::timed("parse", [] { return aoc::parse_items<Step>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(steps); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
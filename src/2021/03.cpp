@@ -72,13 +72,13 @@ Bits parse_bitset(const std::string& s) {
 }
 
 int main() {
-  const auto nums{
-      aoc::parse_items<std::string>("/dev/stdin") | views::transform(parse_bitset)
-      | ranges::to<std::vector>()
-  };
+  const auto nums{aoc::timed("parse", [] {
+    return aoc::parse_items<std::string>("/dev/stdin") | views::transform(parse_bitset)
+           | ranges::to<std::vector>();
+  })};
 
-  const auto part1{find_part1(nums)};
-  const auto part2{find_part2(nums)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(nums); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(nums); })};
   std::println("{} {}", part1, part2);
 
   return 0;
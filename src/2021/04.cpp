@@ -105,8 +105,8 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [numbers, boards]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{play(numbers, boards)};
+  const auto [numbers, boards]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return play(numbers, boards); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
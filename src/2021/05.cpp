@@ -86,8 +86,8 @@ std::istream& operator>>(std::istream& is, Segment& segment) {
 }
 
 int main() {
-  const auto segments{aoc::parse_items<Segment>("/dev/stdin")};
-  const auto [part1, part2]{search(segments)};
+  const auto segments{aoc::timed("parse", [] { return aoc::parse_items<Segment>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(segments); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
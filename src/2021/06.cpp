@@ -24,9 +24,9 @@ auto simulate(const auto& timers, const int days) {
 }
 
 int main() {
-  const auto timers{aoc::parse_items<int>("/dev/stdin", ',')};
-  const auto part1{simulate(timers, 80)};
-  const auto part2{simulate(timers, 256)};
+  const auto timers{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin", ','); })};
+  const auto part1{aoc::timed("part1", [&] { return simulate(timers, 80); })};
+  const auto part2{aoc::timed("part2", [&] { return simulate(timers, 256); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -24,8 +24,8 @@ auto search(const auto& crabs) {
 }
 
 int main() {
-  const auto crabs{aoc::parse_items<int>("/dev/stdin", ',')};
-  const auto [part1, part2]{search(crabs)};
+  const auto crabs{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin", ','); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(crabs); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
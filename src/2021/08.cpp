@@ -68,8 +68,8 @@ std::istream& operator>>(std::istream& is, Entry& entry) {
 }
 
 int main() {
-  const auto entries{aoc::parse_items<Entry>("/dev/stdin")};
-  const auto [part1, part2]{search(entries)};
+  const auto entries{aoc::timed("parse", [] { return aoc::parse_items<Entry>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(entries); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -77,8 +77,8 @@ Map parse_map(std::string_view path) {
 }
 
 int main() {
-  const Map m{parse_map("/dev/stdin")};
-  const auto [part1, part2]{search_basins(m)};
+  const Map m{aoc::timed("parse", [] { return parse_map("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search_basins(m); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
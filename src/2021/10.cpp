@@ -104,8 +104,8 @@ auto search(const auto& lines) {
 }
 
 int main() {
-  const auto lines{aoc::parse_items<std::string>("/dev/stdin")};
-  const auto [part1, part2]{search(lines)};
+  const auto lines{aoc::timed("parse", [] { return aoc::parse_items<std::string>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(lines); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -140,10 +140,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [grid, folds]{parse_input("/dev/stdin")};
+  const auto [grid, folds]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(grid, folds)};
-  const auto part2{find_part2(grid, folds)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(grid, folds); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(grid, folds); })};
 
   std::println("{} {}", part1, part2);
 
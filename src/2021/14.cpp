@@ -68,10 +68,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [polymer, rules]{parse_input("/dev/stdin")};
+  const auto [polymer, rules]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{apply_steps(polymer, rules, 10)};
-  const auto part2{apply_steps(polymer, rules, 40)};
+  const auto part1{aoc::timed("part1", [&] { return apply_steps(polymer, rules, 10); })};
+  const auto part2{aoc::timed("part2", [&] { return apply_steps(polymer, rules, 40); })};
 
   std::println("{} {}", part1, part2);
 
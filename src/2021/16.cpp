@@ -162,10 +162,10 @@ Packet parse_packet(std::istream& is) {
 
 int main() {
   std::ios::sync_with_stdio(false);
-  const Packet p{parse_packet(std::cin)};
+  const Packet p{aoc::timed("parse", [] { return parse_packet(std::cin); })};
 
-  const auto part1{p.version_sum()};
-  const auto part2{p.eval()};
+  const auto part1{aoc::timed("part1", [&] { return p.version_sum(); })};
+  const auto part2{aoc::timed("part2", [&] { return p.eval(); })};
 
   std::println("{} {}", part1, part2);
 
@@ -76,8 +76,8 @@ int main() {
   std::ios::sync_with_stdio(false);
   const auto [lo, hi]{parse_target_area(std::cin)};
 
-  const auto part1{find_part1(lo, hi)};
-  const auto part2{find_part2(lo, hi)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(lo, hi); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(lo, hi); })};
 
   std::println("{} {}", part1, part2);
 
@@ -135,10 +135,10 @@ auto parse_lines(std::string_view path) {
 }
 
 int main() {
-  const Lines ls{parse_lines("/dev/stdin")};
+  const Lines ls{aoc::timed("parse", [] { return parse_lines("/dev/stdin"); })};
 
-  const auto part1{find_part1(ls)};
-  const auto part2{find_part2(ls)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(ls); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(ls); })};
 
   std::println("{} {}", part1, part2);
 
@@ -163,11 +163,11 @@ auto parse_scanners(std::string path) {
 }
 
 int main() {
-  auto scanners{parse_scanners("/dev/stdin")};
+  auto scanners{aoc::timed("parse", [] { return parse_scanners("/dev/stdin"); })};
   scanners = recenter(scanners);
 
-  const auto part1{find_part1(scanners)};
-  const auto part2{find_part2(scanners)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(scanners); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(scanners); })};
 
   std::println("{} {}", part1, part2);
 
@@ -1,70 +1,39 @@
 #include "aoc.hpp"
-#include "ndvec.hpp"
+#include "cellular.hpp"
 #include "std.hpp"
 
-namespace ranges = std::ranges;
-namespace views = std::views;
-
-using aoc::skip;
-using std::operator""s;
-using Vec2 = ndvec::vec2<int>;
-
-constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
+using Board = cellular::Board<2>;
 
 struct Image {
-  std::unordered_map<Vec2, int> pixels;
-  std::vector<int> algorithm;
-
-  [[nodiscard]]
-  std::size_t extract_index(const Vec2 mid, int default_px) const {
-    auto idx{0UZ};
-    auto i{0UZ};
-    for (Vec2 p(1, 1); p.y() >= -1; --p.y()) {
-      for (p.x() = 1; p.x() >= -1; --p.x()) {
-        int px{pixels.contains(mid + p) ? pixels.at(mid + p) : default_px};
-        idx += px << i;
-        ++i;
-      }
-    }
-    return idx;
-  }
-
-  [[nodiscard]]
-  Image enhance_step(const int default_px) const {
-    Image img{*this};
-    auto [top, bottom]{ranges::minmax(pixels | views::keys)};
-    top -= Vec2(1, 1);
-    bottom += Vec2(1, 1);
-    for (Vec2 p{top}; p.y() <= bottom.y(); ++p.y()) {
-      for (p.x() = top.x(); p.x() <= bottom.x(); ++p.x()) {
-        img.pixels[p] = algorithm.at(extract_index(p, default_px));
-      }
-    }
-    return img;
-  }
+  Board pixels;
+  std::bitset<512> algorithm;
 
   [[nodiscard]]
   Image enhance(const int n_steps) const {
     Image img{*this};
+    // every pixel outside the image is the same and flips if the algorithm maps 0 to 1
+    bool background{false};
     for (int step{}; step < n_steps; ++step) {
-      int default_px{step % 2 == 0 ? 0 : algorithm.at(0)};
-      img = img.enhance_step(default_px);
+      img.pixels = cellular::step_window(
+          img.pixels, [this](unsigned i) { return algorithm[i]; }, background
+      );
+      background = algorithm[background ? 511 : 0];
     }
     return img;
   }
 
   [[nodiscard]]
   auto count_light() const {
-    return sum(pixels | views::values);
+    return pixels.count();
   }
 };
 
-int parse_pixel(char ch) {
+bool parse_pixel(char ch) {
   if (ch == '#') {
-    return 1;
+    return true;
   }
   if (ch == '.') {
-    return 0;
+    return false;
   }
   throw std::runtime_error(std::format("unknown pixel '{}'", ch));
 }
@@ -72,16 +41,26 @@ int parse_pixel(char ch) {
 Image parse_image(std::string path) {
   Image img;
   std::istringstream is{aoc::slurp_file(path)};
-  if (std::string line; std::getline(is, line)) {
-    img.algorithm = line | views::transform(parse_pixel) | ranges::to<std::vector>();
-    for (Vec2 p; std::getline(is >> std::ws, line); p.y() += 1) {
-      p.x() = 0;
-      for (char ch : line) {
-        img.pixels[p] = parse_pixel(ch);
-        p.x() += 1;
+  if (std::string line; std::getline(is, line) and line.size() == img.algorithm.size()) {
+    for (auto i{0UZ}; i < line.size(); ++i) {
+      img.algorithm[i] = parse_pixel(line[i]);
+    }
+    std::vector<std::string> rows;
+    while (std::getline(is >> std::ws, line)) {
+      if (not rows.empty() and line.size() != rows.front().size()) {
+        throw std::runtime_error("every row must be of same width");
       }
+      rows.push_back(line);
     }
-    if (is.eof()) {
+    if (is.eof() and not rows.empty()) {
+      img.pixels = Board({static_cast<int>(rows.front().size()), static_cast<int>(rows.size())});
+      for (int y{}; const std::string& row : rows) {
+        for (int x{}; char ch : row) {
+          img.pixels.set({x, y}, parse_pixel(ch));
+          x += 1;
+        }
+        y += 1;
+      }
       return img;
     }
   }
@@ -89,10 +68,10 @@ Image parse_image(std::string path) {
 }
 
 int main() {
-  const Image img{parse_image("/dev/stdin")};
+  const Image img{aoc::timed("parse", [] { return parse_image("/dev/stdin"); })};
 
-  const auto part1{img.enhance(2).count_light()};
-  const auto part2{img.enhance(50).count_light()};
+  const auto part1{aoc::timed("part1", [&] { return img.enhance(2).count_light(); })};
+  const auto part2{aoc::timed("part2", [&] { return img.enhance(50).count_light(); })};
 
   std::println("{} {}", part1, part2);
 
@@ -117,11 +117,11 @@ auto parse_players(std::string_view path) {
 }
 
 int main() {
-  const auto [p1, p2]{parse_players("/dev/stdin")};
+  const auto [p1, p2]{aoc::timed("parse", [] { return parse_players("/dev/stdin"); })};
   State state{.pawn1 = p1, .pawn2 = p2};
 
-  const auto part1{find_part1(state)};
-  const auto part2{find_part2(state)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(state); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(state); })};
 
   std::println("{} {}", part1, part2);
 
@@ -6,8 +6,6 @@ namespace ranges = std::ranges;
 namespace views = std::views;
 
 using Vec3 = ndvec::vec3<long>;
-using aoc::skip;
-using std::operator""s;
 
 struct Cuboid {
   Vec3 lo;
@@ -59,33 +57,44 @@ long reboot(ranges::range auto&& steps) {
   }));
 }
 
-std::istream& operator>>(std::istream& is, Step& step) {
-  if (std::string state; is >> std::ws >> state) {
-    if (state == "on"s) {
-      step.on = true;
-    } else if (state == "off"s) {
-      step.on = false;
-    } else {
-      throw std::runtime_error(std::format("state should be 'on' or 'off', not '{}'", state));
+auto parse_steps(std::string_view path) {
+  const aoc::InputView input(path);
+  std::vector<Step> steps;
+  for (std::string_view line : input.lines()) {
+    if (line.empty()) {
+      continue;
     }
-    if (Cuboid c; is >> std::ws >> skip("x="s) >> c.lo.x() >> skip(".."s) >> c.hi.x()
-                  >> skip(",y="s) >> c.lo.y() >> skip(".."s) >> c.hi.y() >> skip(",z="s) >> c.lo.z()
-                  >> skip(".."s) >> c.hi.z()) {
-      step.cuboid = c;
-      return is;
+    const auto fields{aoc::scan<
+        "{} x={}..{},y={}..{},z={}..{}",
+        std::string_view,
+        long,
+        long,
+        long,
+        long,
+        long,
+        long>(line)};
+    if (not fields) {
+      throw std::runtime_error(std::format("failed parsing step '{}'", line));
     }
+    const auto& [state, x0, x1, y0, y1, z0, z1]{*fields};
+    if (state != "on" and state != "off") {
+      throw std::runtime_error(std::format("state should be 'on' or 'off', not '{}'", state));
+    }
+    steps.push_back({
+        .on = state == "on",
+        .cuboid = {Vec3(x0, y0, z0), Vec3(x1, y1, z1)},
+    });
   }
-  if (is.eof()) {
-    return is;
-  }
-  throw std::runtime_error("failed parsing Step");
+  return steps;
 }
 
 int main() {
-  const auto steps{aoc::parse_items<Step>("/dev/stdin")};
+  const auto steps{aoc::timed("parse", [] { return parse_steps("/dev/stdin"); })};
 
-  const auto part1{reboot(steps | views::filter([](auto s) { return s.cuboid.is_init(); }))};
-  const auto part2{reboot(steps)};
+  const auto part1{aoc::timed("part1", [&] {
+    return reboot(steps | views::filter([](auto s) { return s.cuboid.is_init(); }));
+  })};
+  const auto part2{aoc::timed("part2", [&] { return reboot(steps); })};
 
   std::println("{} {}", part1, part2);
 
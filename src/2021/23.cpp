@@ -395,8 +395,8 @@ auto find_part2(auto lines) {
 int main() {
   const auto lines{aoc::slurp_lines("/dev/stdin")};
 
-  const auto part1{find_part1(lines)};
-  const auto part2{find_part2(lines)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(lines); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(lines); })};
 
   std::println("{} {}", part1, part2);
 
@@ -83,7 +83,8 @@ auto parse_constraints(std::string path) {
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_constraints("/dev/stdin"))};
+  const auto constraints{aoc::timed("parse", [] { return parse_constraints("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(constraints); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -86,8 +86,8 @@ Grid parse_grid(std::string_view path) {
 }
 
 int main() {
-  auto grid{parse_grid("/dev/stdin")};
-  const auto part1{simulate(grid)};
+  auto grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto part1{aoc::timed("part1", [&] { return simulate(grid); })};
   std::print("{}\n", part1);
   return 0;
 }
@@ -31,7 +31,7 @@ auto parse_calories(std::string path) {
 constexpr auto sum{std::bind_back(ranges::fold_left, 0L, std::plus{})};
 
 int main() {
-  auto calories{parse_calories("/dev/stdin")};
+  auto calories{aoc::timed("parse", [] { return parse_calories("/dev/stdin"); })};
   ranges::sort(calories, ranges::greater{});
 
   const auto part1{calories.front()};
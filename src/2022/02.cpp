@@ -57,10 +57,10 @@ auto parse_games(std::string_view path) {
 }
 
 int main() {
-  const auto games{parse_games("/dev/stdin")};
+  const auto games{aoc::timed("parse", [] { return parse_games("/dev/stdin"); })};
 
-  const auto part1{find_part1(games)};
-  const auto part2{find_part2(games)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(games); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(games); })};
 
   std::println("{} {}", part1, part2);
 
@@ -64,8 +64,8 @@ int main() {
     throw std::runtime_error("every line must be of even length");
   }
 
-  const auto part1{find_part1(lines)};
-  const auto part2{find_part2(lines)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(lines); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(lines); })};
 
   std::println("{} {}", part1, part2);
 
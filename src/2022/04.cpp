@@ -46,10 +46,10 @@ auto parse_pairs(std::string_view path) {
 }
 
 int main() {
-  const auto pairs{parse_pairs("/dev/stdin")};
+  const auto pairs{aoc::timed("parse", [] { return parse_pairs("/dev/stdin"); })};
 
-  const auto part1{find_part1(pairs)};
-  const auto part2{find_part2(pairs)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(pairs); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(pairs); })};
 
   std::println("{} {}", part1, part2);
 
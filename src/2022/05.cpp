@@ -95,10 +95,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [stacks, moves]{parse_input("/dev/stdin")};
+  const auto [stacks, moves]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{search(stacks, moves, Mover::v9000)};
-  const auto part2{search(stacks, moves, Mover::v9001)};
+  const auto part1{aoc::timed("part1", [&] { return search(stacks, moves, Mover::v9000); })};
+  const auto part2{aoc::timed("part2", [&] { return search(stacks, moves, Mover::v9001); })};
 
   std::println("{} {}", part1, part2);
 
@@ -18,8 +18,8 @@ auto find_distinct(std::string input, std::size_t msg_len) {
 int main() {
   const auto input{aoc::slurp_file("/dev/stdin")};
 
-  const auto part1{find_distinct(input, 4)};
-  const auto part2{find_distinct(input, 14)};
+  const auto part1{aoc::timed("part1", [&] { return find_distinct(input, 4); })};
+  const auto part2{aoc::timed("part2", [&] { return find_distinct(input, 14); })};
 
   std::println("{} {}", part1, part2);
 
@@ -67,15 +67,15 @@ FileSystem parse_file_system(std::string_view path) {
 }
 
 int main() {
-  const FileSystem fs{parse_file_system("/dev/stdin")};
+  const FileSystem fs{aoc::timed("parse", [] { return parse_file_system("/dev/stdin"); })};
   const auto du{
       fs | views::keys
       | views::transform([&fs](Path p) { return std::pair{p, count_disk_usage(fs, p)}; })
       | ranges::to<std::unordered_map>()
   };
 
-  const auto part1{find_part1(du)};
-  const auto part2{find_part2(du)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(du); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(du); })};
 
   std::println("{} {}", part1, part2);
 
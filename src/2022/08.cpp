@@ -46,7 +46,8 @@ Trees parse_trees(std::string_view path) {
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_trees("/dev/stdin"))};
+  const auto trees{aoc::timed("parse", [] { return parse_trees("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(trees); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -74,8 +74,8 @@ auto parse_instructions(std::string_view path) {
 }
 
 int main() {
-  const auto adds{parse_instructions("/dev/stdin")};
-  const auto [part1, part2]{search(adds)};
+  const auto adds{aoc::timed("parse", [] { return parse_instructions("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(adds); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -133,10 +133,10 @@ std::istream& operator>>(std::istream& is, Monkey& monkey) {
 }
 
 int main() {
-  const auto monkeys{aoc::parse_items<Monkey>("/dev/stdin")};
+  const auto monkeys{aoc::timed("parse", [] { return aoc::parse_items<Monkey>("/dev/stdin"); })};
 
-  const auto part1{run_monkey_business(monkeys, 3, 20)};
-  const auto part2{run_monkey_business(monkeys, 1, 10'000)};
+  const auto part1{aoc::timed("part1", [&] { return run_monkey_business(monkeys, 3, 20); })};
+  const auto part2{aoc::timed("part2", [&] { return run_monkey_business(monkeys, 1, 10'000); })};
 
   std::println("{} {}", part1, part2);
 
@@ -103,14 +103,14 @@ std::istream& operator>>(std::istream& is, Packet& packet) {
 }
 
 int main() {
-  const auto packets{aoc::parse_items<Packet>("/dev/stdin")};
+  const auto packets{aoc::timed("parse", [] { return aoc::parse_items<Packet>("/dev/stdin"); })};
 
   if (packets.empty() or (packets.size() % 2) != 0) {
     throw std::runtime_error("input must contain an even number of packets");
   }
 
-  const auto part1{find_part1(packets)};
-  const auto part2{find_part2(packets)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(packets); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(packets); })};
 
   std::println("{} {}", part1, part2);
 
@@ -74,8 +74,8 @@ auto parse_obstacles(std::string_view path) {
 }
 
 int main() {
-  const auto obstacles{parse_obstacles("/dev/stdin")};
-  const auto [part1, part2]{search(obstacles)};
+  const auto obstacles{aoc::timed("parse", [] { return parse_obstacles("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(obstacles); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
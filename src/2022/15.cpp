@@ -85,10 +85,10 @@ std::istream& operator>>(std::istream& is, Sensor& sensor) {
 }
 
 int main() {
-  const auto sensors{aoc::parse_items<Sensor>("/dev/stdin")};
+  const auto sensors{aoc::timed("parse", [] { return aoc::parse_items<Sensor>("/dev/stdin"); })};
 
-  const auto part1{find_part1(sensors)};
-  const auto part2{find_part2(sensors)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(sensors); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(sensors); })};
 
   std::println("{} {}", part1, part2);
 
@@ -215,7 +215,10 @@ auto search(auto valves) {
 }
 
 int main() {
-  const auto [part1, part2]{search(aoc::parse_items<Valve>("/dev/stdin"))};
+  auto valves{aoc::timed("parse", [] { return aoc::parse_items<Valve>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(std::move(valves));
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -262,11 +262,15 @@ auto infer_tower_height(const auto& height_deltas, const auto& cycle, const std:
 }
 
 int main() {
-  const auto jet{aoc::parse_items<Direction>("/dev/stdin")};
+  const auto jet{aoc::timed("parse", [] { return aoc::parse_items<Direction>("/dev/stdin"); })};
 
   const auto [height_deltas, cycle]{simulate_until_cycle(jet)};
-  const auto part1{infer_tower_height(height_deltas, cycle, 2022)};
-  const auto part2{infer_tower_height(height_deltas, cycle, 1'000'000'000'000)};
+  const auto part1{aoc::timed("part1", [&] {
+    return infer_tower_height(height_deltas, cycle, 2022);
+  })};
+  const auto part2{aoc::timed("part2", [&] {
+    return infer_tower_height(height_deltas, cycle, 1'000'000'000'000);
+  })};
 
   std::println("{} {}", part1, part2);
 
@@ -32,20 +32,25 @@ int count_3d_surface(const auto& points) {
 }
 
 int main() {
+  const auto cubes{aoc::timed("parse", [] { return aoc::parse_items<Vec3>("/dev/stdin", ','); })};
+
   int n_sides{};
   std::unordered_set<Vec3> points;
-  for (Vec3 p : aoc::parse_items<Vec3>("/dev/stdin", ',')) {
-    n_sides += 6;
-    for (Vec3 adj : p.adjacent()) {
-      if (points.contains(adj)) {
-        n_sides -= 2;
+  {
+    const aoc::ScopeTimer timer{"part1"};
+    for (Vec3 p : cubes) {
+      n_sides += 6;
+      for (Vec3 adj : p.adjacent()) {
+        if (points.contains(adj)) {
+          n_sides -= 2;
+        }
       }
+      points.insert(p);
     }
-    points.insert(p);
   }
 
   const auto part1{n_sides};
-  const auto part2{count_3d_surface(points)};
+  const auto part2{aoc::timed("part2", [&] { return count_3d_surface(points); })};
 
   std::println("{} {}", part1, part2);
 
@@ -4,9 +4,6 @@
 namespace ranges = std::ranges;
 namespace views = std::views;
 
-using aoc::skip;
-using std::operator""s;
-
 struct Rocks {
   int ore{};
   int clay{};
@@ -183,56 +180,41 @@ auto find_part2(auto blueprints) {
   }));
 }
 
-std::istream& operator>>(std::istream& is, Rocks& rocks) {
-  bool ok{false};
-  for (auto [kind, amount]{std::pair{""s, int{}}};
-       is >> amount >> kind and amount > 0 and not kind.empty();) {
-    if (kind.starts_with("ore"s)) {
-      rocks.ore = amount;
-    } else if (kind.starts_with("clay"s)) {
-      rocks.clay = amount;
-    } else if (kind.starts_with("obsidian"s)) {
-      rocks.obsidian = amount;
-    }
-    if (kind.ends_with("."s)) {
-      ok = true;
-      break;
-    }
-    if (not(is >> kind and kind == "and"s)) {
-      break;
-    }
-  }
-  if (not ok and not is.eof()) {
-    throw std::runtime_error("failed parsing Rocks");
-  }
-  return is;
-}
-
-std::istream& operator>>(std::istream& is, Blueprint& bp) {
-  bool ok{false};
-  if (int id{}; is >> std::ws >> skip("Blueprint"s) >> id >> skip(":"s)) {
-    if (Rocks ore; is >> std::ws >> skip("Each ore robot costs"s) >> ore) {
-      if (Rocks clay; is >> std::ws >> skip("Each clay robot costs"s) >> clay) {
-        if (Rocks obsidian; is >> std::ws >> skip("Each obsidian robot costs"s) >> obsidian) {
-          if (Rocks geodes; is >> std::ws >> skip("Each geode robot costs"s) >> geodes) {
-            bp = {id, ore, clay, obsidian, geodes};
-            ok = true;
-          }
-        }
-      }
+auto parse_blueprints(std::string_view path) {
+  const aoc::InputView input(path);
+  std::vector<Blueprint> blueprints;
+  for (auto rest{input.data()}; rest.find_first_not_of(" \n") != std::string_view::npos;) {
+    const auto fields{aoc::scan_prefix<
+        " Blueprint {}:"
+        " Each ore robot costs {} ore."
+        " Each clay robot costs {} ore."
+        " Each obsidian robot costs {} ore and {} clay."
+        " Each geode robot costs {} ore and {} obsidian.">(rest)};
+    if (not fields) {
+      throw std::runtime_error("failed parsing Blueprint");
     }
+    const auto [id, ore_ore, clay_ore, obsidian_ore, obsidian_clay, geode_ore, geode_obsidian]{
+        *fields
+    };
+    blueprints.push_back({
+        .id = id,
+        .ore_robot_cost = {.ore = ore_ore},
+        .clay_robot_cost = {.ore = clay_ore},
+        .obsidian_robot_cost = {.ore = obsidian_ore, .clay = obsidian_clay},
+        .geode_robot_cost = {.ore = geode_ore, .obsidian = geode_obsidian},
+    });
   }
-  if (not ok and not is.eof()) {
-    throw std::runtime_error("failed parsing Blueprint");
+  if (blueprints.empty()) {
+    throw std::runtime_error("input is empty");
   }
-  return is;
+  return blueprints;
 }
 
 int main() {
-  const auto blueprints{aoc::parse_items<Blueprint>("/dev/stdin")};
+  const auto blueprints{aoc::timed("parse", [] { return parse_blueprints("/dev/stdin"); })};
 
-  const auto part1{find_part1(blueprints)};
-  const auto part2{find_part2(blueprints)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(blueprints); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(blueprints); })};
 
   std::println("{} {}", part1, part2);
 
@@ -1,5 +1,4 @@
 #include "aoc.hpp"
-#include "my_std.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
@@ -11,32 +10,26 @@ auto rem_euclid(long x, long n) {
 
 constexpr auto sum{std::bind_back(ranges::fold_left, 0L, std::plus{})};
 
-// adapted from
-// https://www.reddit.com/r/adventofcode/comments/zqezkn/comment/j0xxfet
-// accessed 2024-05-19
-auto search(std::vector<long> input, long key, int n_iterations) {
-  auto index{views::iota(0UZ, input.size()) | ranges::to<std::vector>()};
+auto search(const std::vector<long>& input, long key, int n_iterations) {
+  const auto n{ranges::ssize(input)};
+  aoc::BlockList order(input.size(), views::iota(0UZ, input.size()));
   while (n_iterations-- > 0) {
-    for (auto [i, num] : my_std::views::enumerate(input)) {
-      auto src{ranges::find(index, i) - index.begin()};
-      auto dst{rem_euclid(src + num * key, ranges::ssize(index) - 1)};
-      index.erase(index.begin() + src);
-      index.insert(index.begin() + dst, i);
+    for (auto i{0UZ}; i < input.size(); ++i) {
+      const auto src{static_cast<long>(order.position(i))};
+      order.move(i, rem_euclid(src + input[i] * key, n - 1));
     }
   }
-  const auto zero_pos{
-      ranges::find(index, (ranges::find(input, 0) - input.begin())) - index.begin()
-  };
-  return key * sum(views::transform(std::array{1000, 2000, 3000}, [&](int n) {
-           return input.at(index.at(rem_euclid(zero_pos + n, ranges::ssize(index))));
+  const auto zero_pos{static_cast<long>(order.position(ranges::find(input, 0) - input.begin()))};
+  return key * sum(views::transform(std::array{1000, 2000, 3000}, [&](int offset) {
+           return input.at(order.at(rem_euclid(zero_pos + offset, n)));
          }));
 }
 
 int main() {
-  const auto input{aoc::parse_items<long>("/dev/stdin")};
+  const auto input{aoc::timed("parse", [] { return aoc::parse_items<long>("/dev/stdin"); })};
 
-  const auto part1{search(input, 1, 1)};
-  const auto part2{search(input, 811'589'153, 10)};
+  const auto part1{aoc::timed("part1", [&] { return search(input, 1, 1); })};
+  const auto part2{aoc::timed("part2", [&] { return search(input, 811'589'153, 10); })};
 
   std::println("{} {}", part1, part2);
 
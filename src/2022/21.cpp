@@ -189,10 +189,10 @@ Program parse_program(std::string_view path) {
 }
 
 int main() {
-  const auto prog{parse_program("/dev/stdin")};
+  const auto prog{aoc::timed("parse", [] { return parse_program("/dev/stdin"); })};
 
-  const auto part1{find_part1(prog)};
-  const auto part2{find_part2(prog)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(prog); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(prog); })};
 
   std::println("{} {}", part1, part2);
 
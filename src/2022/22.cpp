@@ -235,10 +235,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [grid, moves]{parse_input("/dev/stdin")};
+  const auto [grid, moves]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{search(grid, moves, WrapType::square)};
-  const auto part2{search(grid, moves, WrapType::cube)};
+  const auto part1{aoc::timed("part1", [&] { return search(grid, moves, WrapType::square); })};
+  const auto part2{aoc::timed("part2", [&] { return search(grid, moves, WrapType::cube); })};
 
   std::println("{} {}", part1, part2);
 
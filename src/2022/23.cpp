@@ -1,11 +1,14 @@
 #include "aoc.hpp"
-#include "ndvec.hpp"
+#include "cellular.hpp"
 #include "std.hpp"
 
 namespace ranges = std::ranges;
 namespace views = std::views;
 
-using Vec2 = ndvec::vec2<int>;
+using cellular::east_of;
+using cellular::west_of;
+using cellular::Word;
+using Board = cellular::Board<2>;
 
 enum struct Direction : unsigned char {
   north,
@@ -19,69 +22,122 @@ auto next(Direction d, int turn = 1) {
 }
 
 struct Grid {
-  std::unordered_set<Vec2> elves;
+  Board elves;
 
   [[nodiscard]]
-  bool has_adjacent_elf(Vec2 pos, Vec2 dir) const {
-    for (Vec2 d(-1, -1); d.y() <= 1; d.y() += 1) {
-      for (d.x() = -1; d.x() <= 1; d.x() += 1) {
-        if ((dir.x() == 0 or d.x() == dir.x()) and (dir.y() == 0 or d.y() == dir.y())) {
-          if (Vec2 adj{pos + d}; adj != pos and elves.contains(adj)) {
-            return true;
-          }
-        }
-      }
+  bool touches_border() const {
+    const auto [width, height]{elves.shape()};
+    const auto last_bit{static_cast<std::size_t>(width - 1) % cellular::word_bits};
+    if (ranges::any_of(elves.row(0), std::identity{})
+        or ranges::any_of(elves.row(height - 1), std::identity{})) {
+      return true;
     }
-    return false;
+    return ranges::any_of(views::iota(0UZ, elves.n_rows()), [&](auto r) {
+      const auto row{elves.row(r)};
+      return (row.front() & 1U) or ((row.back() >> last_bit) & 1U);
+    });
   }
 
-  [[nodiscard]]
-  bool has_adjacent_elves(Vec2 pos) const {
-    return ranges::any_of(
-        std::array{Vec2(0, 1), Vec2(0, -1), Vec2(1, 0), Vec2(-1, 0)},
-        [pos, this](Vec2 dir) { return has_adjacent_elf(pos, dir); }
-    );
-  }
+  // Move all elves for one round, returns true if any elf moved.
+  // Two elves can only propose the same tile from opposite sides, so the proposals are resolved
+  // by comparing the north-south and west-east movers separately.
+  bool move(const Direction start_dir) {
+    if (touches_border()) {
+      elves = elves.grown(8);
+    }
+    const auto row_words{elves.row_words()};
+    const auto n_rows{elves.n_rows()};
+    const std::vector<Word> empty_row(row_words);
+    const auto row_or_empty{[&](const Board& b, std::size_t r, int dr) {
+      return r + dr < n_rows ? b.row(r + dr) : std::span<const Word>(empty_row);
+    }};
+
+    std::array<Board, 4> proposals;
+    proposals.fill(Board(elves.shape()));
+    for (auto r{0UZ}; r < n_rows; ++r) {
+      const auto north{row_or_empty(elves, r, -1)};
+      const auto mid{elves.row(r)};
+      const auto south{row_or_empty(elves, r, 1)};
+      for (auto k{0UZ}; k < row_words; ++k) {
+        const auto nw{west_of(north, k)};
+        const auto ne{east_of(north, k)};
+        const auto sw{west_of(south, k)};
+        const auto se{east_of(south, k)};
+        const std::array<Word, 4> free{
+            ~(nw | north[k] | ne),
+            ~(sw | south[k] | se),
+            ~(nw | west_of(mid, k) | sw),
+            ~(ne | east_of(mid, k) | se),
+        };
+        auto remaining{mid[k] & ~(free[0] & free[1] & free[2] & free[3])};
+        for (int turn{}; turn < 4; ++turn) {
+          const auto d{std::to_underlying(next(start_dir, turn))};
+          proposals[d].row(r)[k] = remaining & free[d];
+          remaining &= ~free[d];
+        }
+      }
+    }
 
-  [[nodiscard]]
-  std::optional<Vec2> find_move(Vec2 pos, Direction start_dir) const {
-    for (int turn{}; turn < 4; ++turn) {
-      Vec2 dir;
-      switch (next(start_dir, turn)) {
-        case Direction::north: {
-          dir = Vec2(0, -1);
-        } break;
-        case Direction::south: {
-          dir = Vec2(0, 1);
-        } break;
-        case Direction::west: {
-          dir = Vec2(-1, 0);
-        } break;
-        case Direction::east: {
-          dir = Vec2(1, 0);
-        } break;
+    const auto& [to_north, to_south, to_west, to_east]{proposals};
+    Board clash_ns(elves.shape());
+    Board clash_we(elves.shape());
+    for (auto r{0UZ}; r < n_rows; ++r) {
+      const auto from_south{row_or_empty(to_north, r, 1)};
+      const auto from_north{row_or_empty(to_south, r, -1)};
+      for (auto k{0UZ}; k < row_words; ++k) {
+        clash_ns.row(r)[k] = from_south[k] & from_north[k];
+        clash_we.row(r)[k] = east_of(to_west.row(r), k) & west_of(to_east.row(r), k);
       }
-      if (not has_adjacent_elf(pos, dir)) {
-        return pos + dir;
+    }
+
+    bool moved{false};
+    Board after(elves.shape());
+    for (auto r{0UZ}; r < n_rows; ++r) {
+      const auto from_south{row_or_empty(to_north, r, 1)};
+      const auto from_north{row_or_empty(to_south, r, -1)};
+      const auto ns{clash_ns.row(r)};
+      const auto we{clash_we.row(r)};
+      for (auto k{0UZ}; k < row_words; ++k) {
+        const auto arrived{
+            ((from_south[k] | from_north[k]) & ~ns[k])
+            | ((east_of(to_west.row(r), k) | west_of(to_east.row(r), k)) & ~we[k])
+        };
+        const auto bounced{
+            (to_north.row(r)[k] & row_or_empty(clash_ns, r, -1)[k])
+            | (to_south.row(r)[k] & row_or_empty(clash_ns, r, 1)[k])
+            | (to_west.row(r)[k] & west_of(we, k)) | (to_east.row(r)[k] & east_of(we, k))
+        };
+        const auto proposed{
+            to_north.row(r)[k] | to_south.row(r)[k] | to_west.row(r)[k] | to_east.row(r)[k]
+        };
+        after.row(r)[k] = (elves.row(r)[k] & ~proposed) | bounced | arrived;
+        moved = moved or arrived != 0;
       }
     }
-    return std::nullopt;
+    elves = std::move(after);
+    return moved;
   }
 };
 
 auto find_part1(const Grid& g) {
-  const auto [p_min, p_max]{
-      ranges::fold_left(g.elves, std::pair{Vec2(), Vec2()}, [](auto minmax, const Vec2& p) {
-        return std::pair{minmax.first.min(p), minmax.second.max(p)};
-      })
-  };
-  int n{};
-  for (Vec2 p{p_min}; p.y() <= p_max.y(); p.y() += 1) {
-    for (p.x() = p_min.x(); p.x() <= p_max.x(); p.x() += 1) {
-      n += int{not g.elves.contains(p)};
+  const auto& elves{g.elves};
+  int x_min{std::numeric_limits<int>::max()};
+  int x_max{std::numeric_limits<int>::min()};
+  int y_min{x_min};
+  int y_max{x_max};
+  for (auto r{0UZ}; r < elves.n_rows(); ++r) {
+    for (auto k{0UZ}; k < elves.row_words(); ++k) {
+      if (const auto w{elves.row(r)[k]}; w != 0) {
+        const auto x0{static_cast<int>(k * cellular::word_bits)};
+        x_min = std::min(x_min, x0 + std::countr_zero(w));
+        x_max = std::max(x_max, x0 + static_cast<int>(std::bit_width(w)) - 1);
+        y_min = std::min(y_min, static_cast<int>(r));
+        y_max = std::max(y_max, static_cast<int>(r));
+      }
     }
   }
-  return n;
+  const auto area{(x_max - x_min + 1) * (y_max - y_min + 1)};
+  return area - static_cast<int>(elves.count());
 }
 
 auto search(Grid grid) {
@@ -90,32 +146,13 @@ auto search(Grid grid) {
 
   auto dir{Direction::north};
   for (int round{}; round < 10'000 and (not part1 or not part2); ++round) {
-    std::unordered_map<Vec2, Vec2> moves;
-    std::unordered_map<Vec2, int> target_counts;
-
-    for (Vec2 pos : grid.elves) {
-      if (grid.has_adjacent_elves(pos)) {
-        if (auto dst{grid.find_move(pos, dir)}) {
-          moves[pos] = *dst;
-          target_counts[*dst] += 1;
-        }
-      }
-    }
-
-    for (auto [src, dst] : moves) {
-      if (target_counts[dst] == 1) {
-        grid.elves.erase(src);
-        grid.elves.insert(dst);
-      }
-    }
-
+    const bool moved{grid.move(dir)};
     if (round == 10) {
       part1 = find_part1(grid);
     }
-    if (ranges::count(views::values(target_counts), 1) == 0) {
+    if (not moved) {
       part2 = round + 1;
     }
-
     dir = next(dir);
   }
 
@@ -123,24 +160,28 @@ auto search(Grid grid) {
 }
 
 Grid parse_grid(std::string_view path) {
-  Grid grid;
-  for (Vec2 p; const std::string& line : aoc::slurp_lines(path)) {
-    p.x() = 0;
-    for (char ch : line) {
+  const auto lines{aoc::slurp_lines(path)};
+  Grid grid{Board({static_cast<int>(lines.front().size()), static_cast<int>(lines.size())})};
+  for (int y{}; const std::string& line : lines) {
+    if (line.size() != lines.front().size()) {
+      throw std::runtime_error("every row must be of same width");
+    }
+    for (int x{}; char ch : line) {
       if (ch == '#') {
-        grid.elves.insert(p);
+        grid.elves.set({x, y});
       } else if (ch != '.') {
         throw std::runtime_error(std::format("unknown grid tile '{}'", ch));
       }
-      p.x() += 1;
+      x += 1;
     }
-    p.y() += 1;
+    y += 1;
   }
   return grid;
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_grid("/dev/stdin"))};
+  auto grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("search", [&] { return search(std::move(grid)); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -152,8 +152,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [grid, begin, end]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(grid, begin, end)};
+  const auto [grid, begin, end]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return search(grid, begin, end);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
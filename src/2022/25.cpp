@@ -85,7 +85,7 @@ auto find_part1(const auto& lines) {
 
 int main() {
   const auto lines{aoc::slurp_lines("/dev/stdin")};
-  const auto part1{find_part1(lines)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(lines); })};
   std::println("{}", part1);
   return 0;
 }
@@ -55,8 +55,8 @@ auto calibrate(const auto& lines) {
 int main() {
   const auto lines{aoc::slurp_lines("/dev/stdin")};
 
-  const auto part1{calibrate(lines)};
-  const auto part2{calibrate(prepare_part2(lines))};
+  const auto part1{aoc::timed("part1", [&] { return calibrate(lines); })};
+  const auto part2{aoc::timed("part2", [&] { return calibrate(prepare_part2(lines)); })};
 
   std::println("{} {}", part1, part2);
 
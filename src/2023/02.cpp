@@ -41,7 +41,9 @@ std::istream& operator>>(std::istream& is, GameMax& gm) {
 constexpr auto sum{std::bind_back(ranges::fold_left, 0, std::plus{})};
 
 int main() {
-  const auto max_counts{aoc::parse_items<GameMax>("/dev/stdin")};
+  const auto max_counts{aoc::timed("parse", [] {
+    return aoc::parse_items<GameMax>("/dev/stdin");
+  })};
 
   auto possible_ids{
       max_counts
@@ -50,8 +52,8 @@ int main() {
   };
   auto powers{max_counts | views::transform([](auto gm) { return gm.red * gm.green * gm.blue; })};
 
-  const auto part1{sum(possible_ids)};
-  const auto part2{sum(powers)};
+  const auto part1{aoc::timed("part1", [&] { return sum(possible_ids); })};
+  const auto part2{aoc::timed("part2", [&] { return sum(powers); })};
 
   std::println("{} {}", part1, part2);
 
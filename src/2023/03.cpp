@@ -88,7 +88,8 @@ Grid parse_grid(std::string_view path) {
 }
 
 int main() {
-  const auto [part1, part2]{search(parse_grid("/dev/stdin"))};
+  const auto grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(grid); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -57,13 +57,13 @@ std::istream& operator>>(std::istream& is, Wins& w) {
 }
 
 int main() {
-  const auto wins{
-      aoc::parse_items<Wins>("/dev/stdin") | views::transform(&Wins::count)
-      | ranges::to<std::vector>()
-  };
+  const auto wins{aoc::timed("parse", [] {
+    return aoc::parse_items<Wins>("/dev/stdin") | views::transform(&Wins::count)
+           | ranges::to<std::vector>();
+  })};
 
-  const auto part1{find_part1(wins)};
-  const auto part2{find_part2(wins)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(wins); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(wins); })};
 
   std::println("{} {}", part1, part2);
 
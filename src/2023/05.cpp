@@ -156,10 +156,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [seeds, map_groups]{parse_input("/dev/stdin")};
+  const auto [seeds, map_groups]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(seeds, map_groups)};
-  const auto part2{find_part2(seeds, map_groups)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(seeds, map_groups); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(seeds, map_groups); })};
 
   std::println("{} {}", part1, part2);
 
@@ -50,11 +50,11 @@ int main() {
   std::istringstream input{aoc::slurp_file("/dev/stdin")};
   using std::operator""s;
 
-  const auto times{parse_input(input, "Time:"s)};
-  const auto dists{parse_input(input, "Distance:"s)};
+  const auto times{aoc::timed("parse", [&] { return parse_input(input, "Time:"s); })};
+  const auto dists{aoc::timed("parse", [&] { return parse_input(input, "Distance:"s); })};
 
-  const auto part1{find_part1(times, dists)};
-  const auto part2{find_part2(times, dists)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(times, dists); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(times, dists); })};
 
   std::println("{} {}", part1, part2);
 
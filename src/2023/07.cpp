@@ -131,13 +131,15 @@ std::istream& operator>>(std::istream& is, Card& card) {
 }
 
 int main() {
-  const auto cards{aoc::parse_items<Card>("/dev/stdin")};
-
-  const auto part1{total_winnings(cards)};
-  const auto part2{total_winnings(views::transform(cards, [](auto c) -> Card {
-    ranges::replace(c.hand.values, char2card('J'), joker_id);
-    return c;
-  }))};
+  const auto cards{aoc::timed("parse", [] { return aoc::parse_items<Card>("/dev/stdin"); })};
+
+  const auto part1{aoc::timed("part1", [&] { return total_winnings(cards); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return total_winnings(views::transform(cards, [](auto c) -> Card {
+      ranges::replace(c.hand.values, char2card('J'), joker_id);
+      return c;
+    }));
+  })};
 
   std::println("{} {}", part1, part2);
 
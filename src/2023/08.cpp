@@ -76,10 +76,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  auto [loop, steps]{parse_input("/dev/stdin")};
+  auto [loop, steps]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(loop, steps)};
-  const auto part2{find_part2(loop, steps)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(loop, steps); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(loop, steps); })};
 
   std::println("{} {}", part1, part2);
 
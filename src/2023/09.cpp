@@ -39,7 +39,8 @@ std::istream& operator>>(std::istream& is, History& h) {
 }
 
 int main() {
-  const auto [part1, part2]{search(aoc::parse_items<History>("/dev/stdin"))};
+  const auto histories{aoc::timed("parse", [] { return aoc::parse_items<History>("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(histories); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -3,7 +3,6 @@
 #include "std.hpp"
 
 namespace ranges = std::ranges;
-namespace views = std::views;
 
 using Vec2 = ndvec::vec2<int>;
 
@@ -18,83 +17,72 @@ enum class Tile : char {
   start = 'S',
 };
 
-struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-  std::size_t width;
+using Grid = aoc::Grid2<Tile>;
 
-  [[nodiscard]]
-  bool is_connected(const Vec2& src, const Vec2& dst) const {
-    if (not tiles.contains(src) or not tiles.contains(dst)) {
-      return false;
-    }
-    if (dst < src) {
-      return is_connected(dst, src);
-    }
-    const Tile t1{tiles.at(src)};
-    const Tile t2{tiles.at(dst)};
-    const Vec2 diff{(dst - src)};
-    if (diff == Vec2(1, 0)) {
-      return (t1 == Tile::EW or t1 == Tile::NE or t1 == Tile::SE or t1 == Tile::start)
-             and (t2 == Tile::EW or t2 == Tile::NW or t2 == Tile::SW or t2 == Tile::start);
-    }
-    if (diff == Vec2(0, 1)) {
-      return (t1 == Tile::NS or t1 == Tile::SW or t1 == Tile::SE or t1 == Tile::start)
-             and (t2 == Tile::NS or t2 == Tile::NE or t2 == Tile::NW or t2 == Tile::start);
-    }
-    return false;
+// The border is ground, which connects to nothing
+bool is_connected(const Grid& grid, const Vec2& src, const Vec2& dst) {
+  if (dst < src) {
+    return is_connected(grid, dst, src);
   }
-
-  [[nodiscard]]
-  auto count_adjacent(Vec2 p) const {
-    return ranges::count_if(p.adjacent(), [p, this](Vec2 adj) { return is_connected(p, adj); });
+  const Tile t1{grid[src]};
+  const Tile t2{grid[dst]};
+  const Vec2 diff{(dst - src)};
+  if (diff == Vec2(1, 0)) {
+    return (t1 == Tile::EW or t1 == Tile::NE or t1 == Tile::SE or t1 == Tile::start)
+           and (t2 == Tile::EW or t2 == Tile::NW or t2 == Tile::SW or t2 == Tile::start);
   }
-
-  [[nodiscard]]
-  auto walk_loop(Vec2 start) const {
-    std::unordered_set<Vec2> path{{start}};
-    for (Vec2 src{start};;) {
-      Vec2 prev{src};
-      for (Vec2 dst : src.adjacent()) {
-        if (not path.contains(dst) and is_connected(src, dst)) {
-          src = dst;
-          break;
-        }
-      }
-      if (prev == src) {
-        return path;
-      }
-      path.insert(src);
-    }
+  if (diff == Vec2(0, 1)) {
+    return (t1 == Tile::NS or t1 == Tile::SW or t1 == Tile::SE or t1 == Tile::start)
+           and (t2 == Tile::NS or t2 == Tile::NE or t2 == Tile::NW or t2 == Tile::start);
   }
+  return false;
+}
 
-  void infer_tile_at(Vec2 p) {
-    for (Tile t : {Tile::NS, Tile::EW, Tile::NE, Tile::NW, Tile::SW, Tile::SE}) {
-      Tile prev{std::exchange(tiles.at(p), t)};
-      if (count_adjacent(p) == 2) {
-        return;
+auto count_adjacent(const Grid& grid, Vec2 p) {
+  return ranges::count_if(p.adjacent(), [&](Vec2 adj) { return is_connected(grid, p, adj); });
+}
+
+// Cells on the loop through start and the length of the loop
+auto walk_loop(const Grid& grid, Vec2 start) {
+  aoc::Grid2<unsigned char> on_loop(grid.width(), grid.height());
+  on_loop[start] = 1;
+  auto length{1UZ};
+  for (Vec2 src{start};;) {
+    Vec2 prev{src};
+    for (Vec2 dst : src.adjacent()) {
+      if (not on_loop[dst] and is_connected(grid, src, dst)) {
+        src = dst;
+        break;
       }
-      tiles.at(p) = prev;
     }
+    if (prev == src) {
+      return std::pair{on_loop, length};
+    }
+    on_loop[src] = 1;
+    length += 1;
   }
-};
+}
 
-auto count_inner(Grid grid, const auto& path, Vec2 start) {
-  grid.infer_tile_at(start);
-  for (auto&& [pos, tile] : grid.tiles) {
-    if (not path.contains(pos)) {
-      tile = Tile::ground;
+void infer_tile_at(Grid& grid, Vec2 p) {
+  for (Tile t : {Tile::NS, Tile::EW, Tile::NE, Tile::NW, Tile::SW, Tile::SE}) {
+    Tile prev{std::exchange(grid[p], t)};
+    if (count_adjacent(grid, p) == 2) {
+      return;
     }
+    grid[p] = prev;
   }
-  auto row_major_points{views::keys(grid.tiles) | ranges::to<std::vector>()};
-  ranges::sort(row_major_points, {}, [](const Vec2& p) { return std::tuple{p.y(), p.x()}; });
+}
+
+auto count_inner(Grid grid, const auto& on_loop, Vec2 start) {
+  infer_tile_at(grid, start);
   return ranges::count_if(
-      row_major_points,
+      grid.positions(),
       [&, prev_angle = Tile::ground, is_in = false](const Vec2& p) mutable {
         if (p.x() == 0) {
           prev_angle = Tile::ground;
           is_in = false;
         }
-        Tile t{grid.tiles.at(p)};
+        const Tile t{on_loop[p] ? grid[p] : Tile::ground};
         if (t == Tile::ground) {
           return is_in;
         }
@@ -112,59 +100,48 @@ auto count_inner(Grid grid, const auto& path, Vec2 start) {
   );
 }
 
-auto search(Grid grid, Vec2 start) {
-  auto path{grid.walk_loop(start)};
+auto search(const Grid& grid, Vec2 start) {
+  const auto [on_loop, length]{walk_loop(grid, start)};
   return std::pair{
-      path.size() / 2,
-      count_inner(grid, path, start),
+      length / 2,
+      count_inner(grid, on_loop, start),
   };
 }
 
 auto parse_grid(std::string_view path) {
-  Grid g{};
+  std::vector<std::string> lines;
+  std::istringstream is{aoc::slurp_file(path)};
+  for (std::string line; std::getline(is, line) and not line.empty();) {
+    lines.push_back(line);
+  }
   std::optional<Vec2> start;
-  {
-    Vec2 p;
-    std::istringstream is{aoc::slurp_file(path)};
-    for (std::string line; std::getline(is, line) and not line.empty(); p.y() += 1) {
-      if (g.width == 0U) {
-        g.width = line.size();
-      } else if (g.width != line.size()) {
-        throw std::runtime_error("every row must be of equal length");
-      }
-      p.x() = 0;
-      for (char ch : line) {
-        switch (ch) {
-          case std::to_underlying(Tile::NS):
-          case std::to_underlying(Tile::EW):
-          case std::to_underlying(Tile::NE):
-          case std::to_underlying(Tile::NW):
-          case std::to_underlying(Tile::SW):
-          case std::to_underlying(Tile::SE):
-          case std::to_underlying(Tile::ground):
-          case std::to_underlying(Tile::start): {
-            g.tiles[p] = {ch};
-          } break;
-          default: {
-            throw std::runtime_error(std::format("unknown tile '{}'", ch));
-          }
-        }
-        if (not start and g.tiles.at(p) == Tile::start) {
+  const auto grid{aoc::parse_grid2(lines, Tile::ground, [&start](char ch, const Vec2& p) {
+    switch (ch) {
+      case std::to_underlying(Tile::start):
+        if (not start) {
           start = p;
         }
-        p.x() += 1;
-      }
+        [[fallthrough]];
+      case std::to_underlying(Tile::NS):
+      case std::to_underlying(Tile::EW):
+      case std::to_underlying(Tile::NE):
+      case std::to_underlying(Tile::NW):
+      case std::to_underlying(Tile::SW):
+      case std::to_underlying(Tile::SE):
+      case std::to_underlying(Tile::ground):
+        return Tile{ch};
     }
-  }
+    throw std::runtime_error(std::format("unknown tile '{}'", ch));
+  })};
   if (not start) {
     throw std::runtime_error("input does not contain start S");
   }
-  return std::pair{g, start.value()};
+  return std::pair{grid, start.value()};
 }
 
 int main() {
-  const auto [grid, start]{parse_grid("/dev/stdin")};
-  const auto [part1, part2]{search(grid, start)};
+  const auto [grid, start]{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(grid, start); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -81,10 +81,10 @@ Space parse_space(std::string_view path) {
 }
 
 int main() {
-  const Space s{parse_space("/dev/stdin")};
+  const Space s{aoc::timed("parse", [] { return parse_space("/dev/stdin"); })};
 
-  const auto part1{s.distance_sum(2)};
-  const auto part2{s.distance_sum(1'000'000)};
+  const auto part1{aoc::timed("part1", [&] { return s.distance_sum(2); })};
+  const auto part2{aoc::timed("part2", [&] { return s.distance_sum(1'000'000); })};
 
   std::println("{} {}", part1, part2);
 
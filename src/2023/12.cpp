@@ -108,10 +108,10 @@ std::istream& operator>>(std::istream& is, Springs& springs) {
 }
 
 int main() {
-  const auto springs{aoc::parse_items<Springs>("/dev/stdin")};
+  const auto springs{aoc::timed("parse", [] { return aoc::parse_items<Springs>("/dev/stdin"); })};
 
-  const auto part1{sum(repeat_and_count_valid(springs, 1))};
-  const auto part2{sum(repeat_and_count_valid(springs, 5))};
+  const auto part1{aoc::timed("part1", [&] { return sum(repeat_and_count_valid(springs, 1)); })};
+  const auto part2{aoc::timed("part2", [&] { return sum(repeat_and_count_valid(springs, 5)); })};
 
   std::println("{} {}", part1, part2);
 
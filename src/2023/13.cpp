@@ -98,10 +98,10 @@ auto parse_mirrors(std::string_view path) {
 }
 
 int main() {
-  const auto mirrors{parse_mirrors("/dev/stdin")};
+  const auto mirrors{aoc::timed("parse", [] { return parse_mirrors("/dev/stdin"); })};
 
-  const auto part1{sum(summarize(mirrors, 0))};
-  const auto part2{sum(summarize(mirrors, 1))};
+  const auto part1{aoc::timed("part1", [&] { return sum(summarize(mirrors, 0)); })};
+  const auto part2{aoc::timed("part2", [&] { return sum(summarize(mirrors, 1)); })};
 
   std::println("{} {}", part1, part2);
 
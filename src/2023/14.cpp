@@ -22,23 +22,22 @@ auto bidirectional_iota(Int begin, Int end) {
 }
 
 struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-  int width{};
-  int height{};
+  // rocks cannot roll past the border
+  aoc::Grid2<Tile> tiles;
 
   [[nodiscard]]
   Tile get(const Vec2& p) const {
-    return tiles.contains(p) ? tiles.at(p) : Tile::pound;
+    return tiles[p];
   }
 
  private:
   [[nodiscard]]
   auto x_range() const {
-    return bidirectional_iota(0, width);
+    return bidirectional_iota(0, tiles.width());
   }
   [[nodiscard]]
   auto y_range() const {
-    return bidirectional_iota(0, height);
+    return bidirectional_iota(0, tiles.height());
   }
 
  public:
@@ -94,7 +93,7 @@ struct Grid {
         const auto x{delta == Vec2(1, 0) ? x_back : x_forward};
         const auto y{delta == Vec2(0, 1) ? y_back : y_forward};
         if (Vec2 p(x, y); get(p) == Tile::round) {
-          std::swap(tiles.at(p), tiles.at(roll(p, delta)));
+          std::swap(tiles[p], tiles[roll(p, delta)]);
         }
       }
     }
@@ -128,41 +127,27 @@ auto find_part2(Grid g1) {
 }
 
 auto parse_grid(std::string_view path) {
-  Grid g{};
-  Vec2 p;
+  std::vector<std::string> lines;
   std::istringstream is{aoc::slurp_file(path)};
-  for (std::string line; std::getline(is, line) and not line.empty(); p.y() += 1) {
-    p.x() = 0;
-    for (char ch : line) {
-      switch (ch) {
-        case std::to_underlying(Tile::round):
-        case std::to_underlying(Tile::pound):
-        case std::to_underlying(Tile::ground): {
-          g.tiles[p] = {ch};
-        } break;
-        default:
-          throw std::runtime_error(std::format("unknown tile '{}'", ch));
-      }
-      p.x() += 1;
-    }
-    if (g.width == 0) {
-      g.width = p.x();
-    } else if (g.width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
+  for (std::string line; std::getline(is, line) and not line.empty();) {
+    lines.push_back(line);
+  }
+  return Grid{aoc::parse_grid2(lines, Tile::pound, [](char ch) {
+    switch (ch) {
+      case std::to_underlying(Tile::round):
+      case std::to_underlying(Tile::pound):
+      case std::to_underlying(Tile::ground):
+        return Tile{ch};
     }
-  }
-  if (p == Vec2()) {
-    throw std::runtime_error("empty input");
-  }
-  g.height = p.y();
-  return g;
+    throw std::runtime_error(std::format("unknown tile '{}'", ch));
+  })};
 }
 
 int main() {
-  const Grid g{parse_grid("/dev/stdin")};
+  const Grid g{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{find_part1(g)};
-  const auto part2{find_part2(g)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(g); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(g); })};
 
   std::println("{} {}", part1, part2);
 
@@ -105,10 +105,10 @@ std::istream& operator>>(std::istream& is, Step& step) {
 }
 
 int main() {
-  const auto steps{aoc::parse_items<Step>("/dev/stdin")};
+  const auto steps{aoc::timed("parse", [] { return aoc::parse_items<Step>("/dev/stdin"); })};
 
-  const auto part1{find_part1(steps)};
-  const auto part2{find_part2(steps)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(steps); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(steps); })};
 
   std::println("{} {}", part1, part2);
 
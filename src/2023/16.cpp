@@ -28,26 +28,24 @@ enum class Tile : char {
   empty = '.',
 };
 
-struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-  int width{};
-  int height{};
-};
+using Grid = aoc::Grid2<Tile>;
 
 auto count_energized(const Grid& grid, const Beam entry) {
-  std::unordered_map<Vec2, Direction> energized;
+  // bit d is set if a beam has passed the position in Direction d
+  aoc::Grid2<unsigned char> energized(grid.width(), grid.height());
   for (std::deque<Beam> q{{entry}}; not q.empty(); q.pop_front()) {
     Beam b{q.front()};
-    if (not grid.tiles.contains(b.pos)) {
+    if (not grid.contains(b.pos)) {
       continue;
     }
 
-    if (energized.contains(b.pos) and b.dir == energized.at(b.pos)) {
+    const auto dir_bit{static_cast<unsigned char>(1U << std::to_underlying(b.dir))};
+    if (energized[b.pos] & dir_bit) {
       continue;
     }
-    energized[b.pos] = b.dir;
+    energized[b.pos] |= dir_bit;
 
-    Tile tile{grid.tiles.at(b.pos)};
+    Tile tile{grid[b.pos]};
 
     const Beam n_beam{Direction::N, b.pos - Vec2(0, 1)};
     const Beam e_beam{Direction::E, b.pos + Vec2(1, 0)};
@@ -129,7 +127,9 @@ auto count_energized(const Grid& grid, const Beam entry) {
       } break;
     }
   }
-  return energized.size();
+  return ranges::count_if(grid.positions(), [&energized](const Vec2& p) {
+    return energized[p] != 0;
+  });
 }
 
 auto find_part1(const Grid& grid) {
@@ -139,13 +139,13 @@ auto find_part1(const Grid& grid) {
 auto find_part2(const Grid& grid) {
   return ranges::max(
       views::transform(
-          views::iota(0, std::max(grid.width, grid.height)),
+          views::iota(0, std::max(grid.width(), grid.height())),
           [&grid](int i) {
             return std::max({
                 count_energized(grid, Beam{Direction::S, Vec2(i, 0)}),
-                count_energized(grid, Beam{Direction::N, Vec2(i, grid.height)}),
+                count_energized(grid, Beam{Direction::N, Vec2(i, grid.height() - 1)}),
                 count_energized(grid, Beam{Direction::E, Vec2(0, i)}),
-                count_energized(grid, Beam{Direction::W, Vec2(grid.width, i)}),
+                count_energized(grid, Beam{Direction::W, Vec2(grid.width() - 1, i)}),
             });
           }
       )
@@ -153,43 +153,29 @@ auto find_part2(const Grid& grid) {
 }
 
 auto parse_grid(std::string_view path) {
-  Grid g{};
-  Vec2 p;
+  std::vector<std::string> lines;
   std::istringstream is{aoc::slurp_file(path)};
-  for (std::string line; std::getline(is, line) and not line.empty(); p.y() += 1) {
-    p.x() = 0;
-    for (char ch : line) {
-      switch (ch) {
-        case std::to_underlying(Tile::split_NS):
-        case std::to_underlying(Tile::split_EW):
-        case std::to_underlying(Tile::mirror_NE):
-        case std::to_underlying(Tile::mirror_NW):
-        case std::to_underlying(Tile::empty): {
-          g.tiles[p] = {ch};
-        } break;
-        default:
-          throw std::runtime_error(std::format("unknown tile '{}'", ch));
-      }
-      p.x() += 1;
-    }
-    if (g.width == 0) {
-      g.width = p.x();
-    } else if (g.width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
-    }
+  for (std::string line; std::getline(is, line) and not line.empty();) {
+    lines.push_back(line);
   }
-  if (p == Vec2()) {
-    throw std::runtime_error("empty input");
-  }
-  g.height = p.y();
-  return g;
+  return aoc::parse_grid2(lines, Tile::empty, [](char ch) {
+    switch (ch) {
+      case std::to_underlying(Tile::split_NS):
+      case std::to_underlying(Tile::split_EW):
+      case std::to_underlying(Tile::mirror_NE):
+      case std::to_underlying(Tile::mirror_NW):
+      case std::to_underlying(Tile::empty):
+        return Tile{ch};
+    }
+    throw std::runtime_error(std::format("unknown tile '{}'", ch));
+  });
 }
 
 int main() {
-  const Grid g{parse_grid("/dev/stdin")};
+  const Grid g{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{find_part1(g)};
-  const auto part2{find_part2(g)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(g); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(g); })};
 
   std::println("{} {}", part1, part2);
 
@@ -2,144 +2,102 @@
 #include "ndvec.hpp"
 #include "std.hpp"
 
-namespace ranges = std::ranges;
-namespace views = std::views;
-
 using Vec2 = ndvec::vec2<int>;
 
-struct Blocks {
-  static constexpr auto max_loss{std::numeric_limits<int>::max()};
-  std::unordered_map<Vec2, int> loss;
-  long width{};
-  long height{};
-
-  [[nodiscard]]
-  auto loss_at(const Vec2& p) const {
-    return loss.contains(p) ? loss.at(p) : max_loss;
-  }
-};
-
-constexpr std::array directions{
-    Vec2(1, 0),
-    Vec2(0, 1),
-    Vec2(-1, 0),
-    Vec2(0, -1),
-};
+// heat loss of every block inside a border of zeros
+using Blocks = aoc::Grid2<int>;
 
 struct State {
-  Vec2 block;
+  std::size_t block{};
   int direction{};
   int moves{};
 };
 
-constexpr auto search(const Blocks& blocks, const int min_moves, const int max_moves) {
+auto search(const Blocks& blocks, const int min_moves, const int max_moves) {
   const auto n_moves{max_moves + 1};
-  const auto n_directions{directions.size()};
-  std::vector<int> min_loss(
-      blocks.width * blocks.height * n_moves * n_directions,
-      Blocks::max_loss
-  );
-
-  const auto loss{[&](const State& s) -> int& {
-    return std::mdspan(
-        min_loss.data(),
-        blocks.width,
-        blocks.height,
-        n_moves,
-        n_directions
-    )[s.block.x(), s.block.y(), s.moves, s.direction];
-  }};
+  const auto n_directions{4};
+  // the directions right, down, left and up
+  const std::array offsets{
+      blocks.adjacent_offsets()[1],
+      blocks.adjacent_offsets()[2],
+      blocks.adjacent_offsets()[3],
+      blocks.adjacent_offsets()[0],
+  };
 
-  const auto push_min_loss_heap{[&](auto& q, const State& s) {
-    q.push_back(s);
-    ranges::push_heap(q, ranges::greater{}, loss);
+  const auto to_index{[&](const State& s) -> std::size_t {
+    return (s.block * n_directions + s.direction) * n_moves + s.moves;
   }};
-  const auto pop_min_loss_heap{[&](auto& q) {
-    ranges::pop_heap(q, ranges::greater{}, loss);
-    State s{q.back()};
-    q.pop_back();
-    return s;
+  const auto to_state{[&](const std::size_t i) {
+    return State{
+        .block = i / n_moves / n_directions,
+        .direction = static_cast<int>(i / n_moves % n_directions),
+        .moves = static_cast<int>(i % n_moves),
+    };
   }};
 
-  const auto [begin, end]{ranges::minmax(views::keys(blocks.loss))};
-
-  std::vector<State> q{
-      {.block = begin, .direction = 0, .moves = 0},
-      {.block = begin, .direction = 1, .moves = 0},
-  };
-  loss(q.at(0)) = 0;
-  loss(q.at(1)) = 0;
-
-  while (not q.empty()) {
-    State src{pop_min_loss_heap(q)};
-    if (src.block == end and min_moves <= src.moves and src.moves <= max_moves) {
-      return loss(src);
-    }
-    for (int dir{}; dir < directions.size(); ++dir) {
-      State dst{
-          .block = src.block + directions.at(dir),
-          .direction = dir,
-      };
-      if ((not blocks.loss.contains(dst.block))
-          or ((dst.direction + 2) % directions.size() == src.direction)
-          or (dst.direction != src.direction and src.moves < min_moves)
-          or (dst.direction == src.direction and src.moves >= max_moves)) {
-        continue;
-      }
-      dst.moves = (dst.direction == src.direction ? src.moves + 1 : 1);
-      if (auto new_loss{aoc::saturating_add(loss(src), blocks.loss_at(dst.block))};
-          new_loss < loss(dst)) {
-        loss(dst) = new_loss;
-        push_min_loss_heap(q, dst);
-      }
-    }
+  const Vec2 end(blocks.width() - 1, blocks.height() - 1);
+  const auto end_block{blocks.index(end)};
+
+  const auto loss{aoc::shortest_path(
+      blocks.buffer_size() * n_directions * n_moves,
+      {
+          to_index({.block = blocks.index(Vec2()), .direction = 0, .moves = 0}),
+          to_index({.block = blocks.index(Vec2()), .direction = 1, .moves = 0}),
+      },
+      [&](const std::size_t i, auto&& relax) {
+        const auto src{to_state(i)};
+        for (int dir{}; dir < n_directions; ++dir) {
+          State dst{
+              .block = src.block + offsets[dir],
+              .direction = dir,
+          };
+          if ((blocks[dst.block] == 0)
+              or ((dst.direction + 2) % n_directions == src.direction)
+              or (dst.direction != src.direction and src.moves < min_moves)
+              or (dst.direction == src.direction and src.moves >= max_moves)) {
+            continue;
+          }
+          dst.moves = (dst.direction == src.direction ? src.moves + 1 : 1);
+          relax(to_index(dst), blocks[dst.block]);
+        }
+      },
+      [&](const std::size_t i) {
+        const auto s{to_state(i)};
+        return s.block == end_block and min_moves <= s.moves and s.moves <= max_moves;
+      },
+      [&](const std::size_t i) { return blocks.position(to_state(i).block).distance(end); }
+  )};
+
+  if (not loss) {
+    throw std::runtime_error("search failed, could not reach end");
   }
-
-  throw std::runtime_error("search failed, could not reach end");
+  return *loss;
 }
 
 auto parse_blocks(std::string_view path) {
-  Blocks blocks{};
-  Vec2 p;
-  for (std::string_view line : aoc::slurp_lines(path)) {
-    p.x() = 0;
-    for (char ch : line) {
-      switch (ch) {
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9': {
-          blocks.loss[p] = ch - '0';
-        } break;
-        default:
-          throw std::runtime_error(std::format("all tiles must be digits, not '{}'", ch));
-      }
-      p.x() += 1;
-    }
-    if (blocks.width == 0) {
-      blocks.width = p.x();
-    } else if (blocks.width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
+  return aoc::parse_grid2(aoc::slurp_lines(path), 0, [](char ch) {
+    switch (ch) {
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7':
+      case '8':
+      case '9':
+        return ch - '0';
+      default:
+        throw std::runtime_error(std::format("all tiles must be digits, not '{}'", ch));
     }
-    p.y() += 1;
-  }
-  if (p == Vec2()) {
-    throw std::runtime_error("empty input");
-  }
-  blocks.height = p.y();
-  return blocks;
+  });
 }
 
 int main() {
-  const Blocks blocks{parse_blocks("/dev/stdin")};
+  const Blocks blocks{aoc::timed("parse", [] { return parse_blocks("/dev/stdin"); })};
 
-  const auto part1{search(blocks, 1, 3)};
-  const auto part2{search(blocks, 4, 10)};
+  const auto part1{aoc::timed("part1", [&] { return search(blocks, 1, 3); })};
+  const auto part2{aoc::timed("part2", [&] { return search(blocks, 4, 10); })};
 
   std::println("{} {}", part1, part2);
 
@@ -84,10 +84,12 @@ std::istream& operator>>(std::istream& is, StepsPair& sp) {
 }
 
 int main() {
-  const auto step_pairs{aoc::parse_items<StepsPair>("/dev/stdin")};
+  const auto step_pairs{aoc::timed("parse", [] {
+    return aoc::parse_items<StepsPair>("/dev/stdin");
+  })};
 
-  const auto part1{dig(views::elements<0>(step_pairs))};
-  const auto part2{dig(views::elements<1>(step_pairs))};
+  const auto part1{aoc::timed("part1", [&] { return dig(views::elements<0>(step_pairs)); })};
+  const auto part2{aoc::timed("part2", [&] { return dig(views::elements<1>(step_pairs)); })};
 
   std::println("{} {}", part1, part2);
 
@@ -221,12 +221,12 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [workflows, ratings]{parse_input("/dev/stdin")};
+  const auto [workflows, ratings]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
   const auto bounds{find_bounds(workflows)};
 
-  const auto part1{find_part1(bounds, ratings)};
-  const auto part2{find_part2(bounds)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(bounds, ratings); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(bounds); })};
 
   std::println("{} {}", part1, part2);
 
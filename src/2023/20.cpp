@@ -206,8 +206,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto modules{update_module_connections(parse_input("/dev/stdin"))};
-  const auto [part1, part2] = search(modules);
+  const auto modules{aoc::timed("parse", [] {
+    return update_module_connections(parse_input("/dev/stdin"));
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(modules); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -15,25 +15,18 @@ enum class Tile : char {
   start = 'S',
 };
 
-struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-  int width{};
-
-  [[nodiscard]]
-  Tile get(const Vec2& p) const {
-    return tiles.contains(p) ? tiles.at(p) : Tile::rock;
-  }
-};
+// surrounded by rocks
+using Grid = aoc::Grid2<Tile>;
 
 auto visit_until_limit(const Vec2& start, const Grid& grid, const int limit) {
-  std::vector<std::vector<bool>> visited(limit + 1, std::vector<bool>(grid.tiles.size()));
-  for (std::deque q{std::pair{0, start}}; not q.empty(); q.pop_front()) {
-    if (auto [step, pos]{q.front()}; step <= limit) {
-      auto i{pos.y() * grid.width + pos.x()};
-      if (not visited.at(step).at(i)) {
-        visited.at(step).at(i) = true;
-        for (const Vec2& adj : pos.adjacent()) {
-          if (grid.get(adj) == Tile::garden) {
+  std::vector<std::vector<bool>> visited(limit + 1, std::vector<bool>(grid.buffer_size()));
+  const auto adjacent{grid.adjacent_offsets()};
+  for (std::deque q{std::pair{0, grid.index(start)}}; not q.empty(); q.pop_front()) {
+    if (auto [step, i]{q.front()}; step <= limit) {
+      if (not visited[step][i]) {
+        visited[step][i] = true;
+        for (const auto offset : adjacent) {
+          if (const auto adj{i + offset}; grid[adj] == Tile::garden) {
             q.emplace_back(step + 1, adj);
           }
         }
@@ -105,42 +98,32 @@ auto repeat_grid(const auto& input_lines, const int n_repeats) {
 }
 
 auto parse_input(std::string_view path) {
-  Grid g{};
   std::optional<Vec2> start;
-  for (Vec2 p; const std::string& line : repeat_grid(aoc::slurp_lines(path), 5)) {
-    p.x() = 0;
-    for (char ch : line) {
-      switch (ch) {
-        case std::to_underlying(Tile::garden):
-        case std::to_underlying(Tile::rock):
-        case std::to_underlying(Tile::start):
-          g.tiles[p] = {ch};
-          break;
-        default:
-          throw std::runtime_error(std::format("unknown tile '{}'", ch));
-      }
-      if (g.tiles.at(p) == Tile::start) {
-        start = p;
+  const auto grid{aoc::parse_grid2(
+      repeat_grid(aoc::slurp_lines(path), 5),
+      Tile::rock,
+      [&start](char ch, const Vec2& p) {
+        switch (ch) {
+          case std::to_underlying(Tile::start):
+            start = p;
+            [[fallthrough]];
+          case std::to_underlying(Tile::garden):
+          case std::to_underlying(Tile::rock):
+            return Tile{ch};
+        }
+        throw std::runtime_error(std::format("unknown tile '{}'", ch));
       }
-      p.x() += 1;
-    }
-    if (g.width == 0U) {
-      g.width = p.x();
-    } else if (g.width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
-    }
-    p.y() += 1;
-  }
+  )};
 
   if (not start) {
     throw std::runtime_error("grid does not contain a start tile S");
   }
-  return std::pair{start.value(), g};
+  return std::pair{start.value(), grid};
 }
 
 int main() {
-  const auto [start, grid]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{search(start, grid)};
+  const auto [start, grid]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(start, grid); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
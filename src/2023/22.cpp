@@ -103,10 +103,10 @@ std::istream& operator>>(std::istream& is, Brick& brick) {
 }
 
 int main() {
-  const SupportGraph sg{aoc::parse_items<Brick>("/dev/stdin")};
+  const SupportGraph sg{aoc::timed("parse", [] { return aoc::parse_items<Brick>("/dev/stdin"); })};
 
-  const auto part1{find_part1(sg)};
-  const auto part2{find_part2(sg)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(sg); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(sg); })};
 
   std::println("{} {}", part1, part2);
 
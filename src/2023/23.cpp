@@ -17,13 +17,12 @@ enum class Tile : char {
 };
 
 struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-  int width{};
-  int height{};
+  // the border is forest
+  aoc::Grid2<Tile> tiles;
 
   [[nodiscard]]
   Tile get(const Vec2& p) const {
-    return tiles.contains(p) ? tiles.at(p) : Tile::forest;
+    return tiles[p];
   }
 
   [[nodiscard]]
@@ -112,7 +111,7 @@ auto find_longest_path(const Grid& grid) {
   };
 
   const Graph::Node start{graph.node_ids.at(Vec2(1, 0))};
-  const Graph::Node end{graph.node_ids.at(Vec2(grid.width - 2, grid.height - 1))};
+  const Graph::Node end{graph.node_ids.at(Vec2(grid.tiles.width() - 2, grid.tiles.height() - 1))};
   int max_dist{};
 
   for (std::vector q{State{.current = start}}; not q.empty();) {
@@ -144,8 +143,8 @@ auto find_part1(const Grid& grid) {
 }
 
 auto find_part2(Grid grid) {
-  for (Tile& t : grid.tiles | views::values) {
-    switch (t) {
+  for (const Vec2& p : grid.tiles.positions()) {
+    switch (Tile& t{grid.tiles[p]}; t) {
       case Tile::up:
       case Tile::right:
       case Tile::down:
@@ -159,41 +158,25 @@ auto find_part2(Grid grid) {
 }
 
 auto parse_grid(std::string_view path) {
-  Grid g{};
-  Vec2 p;
-  for (const std::string& line : aoc::slurp_lines(path)) {
-    p.x() = 0;
-    for (char ch : line) {
-      switch (ch) {
-        case std::to_underlying(Tile::forest):
-        case std::to_underlying(Tile::ground):
-        case std::to_underlying(Tile::up):
-        case std::to_underlying(Tile::right):
-        case std::to_underlying(Tile::down):
-        case std::to_underlying(Tile::left):
-          g.tiles[p] = {ch};
-          break;
-        default:
-          throw std::runtime_error(std::format("unknown tile '{}'", ch));
-      }
-      p.x() += 1;
-    }
-    if (g.width == 0) {
-      g.width = p.x();
-    } else if (g.width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
+  return Grid{aoc::parse_grid2(aoc::slurp_lines(path), Tile::forest, [](char ch) {
+    switch (ch) {
+      case std::to_underlying(Tile::forest):
+      case std::to_underlying(Tile::ground):
+      case std::to_underlying(Tile::up):
+      case std::to_underlying(Tile::right):
+      case std::to_underlying(Tile::down):
+      case std::to_underlying(Tile::left):
+        return Tile{ch};
     }
-    p.y() += 1;
-  }
-  g.height = p.y();
-  return g;
+    throw std::runtime_error(std::format("unknown tile '{}'", ch));
+  })};
 }
 
 int main() {
-  const Grid g{parse_grid("/dev/stdin")};
+  const Grid g{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{find_part1(g)};
-  const auto part2{find_part2(g)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(g); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(g); })};
 
   std::println("{} {}", part1, part2);
 
@@ -114,13 +114,13 @@ std::istream& operator>>(std::istream& is, Stone& stone) {
 }
 
 int main() {
-  const auto stones{aoc::parse_items<Stone>("/dev/stdin")};
+  const auto stones{aoc::timed("parse", [] { return aoc::parse_items<Stone>("/dev/stdin"); })};
   if (stones.size() < 3) {
     throw std::runtime_error("input must contain at least 3 hailstones");
   }
 
-  const auto part1{find_part1(stones)};
-  const auto part2{find_part2(stones)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(stones); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(stones); })};
 
   std::println("{} {}", part1, part2);
 
@@ -158,8 +158,8 @@ Graph parse_graph(std::string_view path) {
 }
 
 int main() {
-  Graph g{parse_graph("/dev/stdin")};
-  const auto part1{find_part1(g)};
+  Graph g{aoc::timed("parse", [] { return parse_graph("/dev/stdin"); })};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(g); })};
   std::print("{}\n", part1);
   return 0;
 }
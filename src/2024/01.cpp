@@ -21,7 +21,7 @@ auto find_part2(const auto& lhs, const auto& rhs) {
 }
 
 int main() {
-  const auto locations{aoc::parse_items<int>("/dev/stdin")};
+  const auto locations{aoc::timed("parse", [] { return aoc::parse_items<int>("/dev/stdin"); })};
 
   // TODO(llvm20) views::stride
   auto lhs{locations | my_std::views::stride(2) | ranges::to<std::vector>()};
@@ -30,8 +30,8 @@ int main() {
   ranges::sort(lhs);
   ranges::sort(rhs);
 
-  const auto part1{find_part1(lhs, rhs)};
-  const auto part2{find_part2(lhs, rhs)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(lhs, rhs); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(lhs, rhs); })};
   std::println("{} {}", part1, part2);
 
   return 0;
@@ -50,8 +50,8 @@ std::vector<Report> parse_reports(std::string path) {
 }
 
 int main() {
-  const auto reports{parse_reports("/dev/stdin")};
-  const auto [part1, part2]{count_safe(reports)};
+  const auto reports{aoc::timed("parse", [] { return parse_reports("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return count_safe(reports); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
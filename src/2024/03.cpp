@@ -34,7 +34,7 @@ auto search(const auto& input) {
 
 int main() {
   const auto input{aoc::slurp_file("/dev/stdin")};
-  const auto [part1, part2]{search(input)};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(input); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -84,10 +84,10 @@ auto parse_grid(std::string_view path) {
 }
 
 int main() {
-  Grid grid{parse_grid("/dev/stdin")};
+  Grid grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{find_part1(grid)};
-  const auto part2{find_part2(grid)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(grid); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(grid); })};
 
   std::println("{} {}", part1, part2);
 
@@ -99,10 +99,10 @@ auto parse_input(std::string path) {
 }
 
 int main() {
-  const auto [rules, updates]{parse_input("/dev/stdin")};
+  const auto [rules, updates]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
 
-  const auto part1{find_part1(rules, updates)};
-  const auto part2{find_part2(rules, updates)};
+  const auto part1{aoc::timed("part1", [&] { return find_part1(rules, updates); })};
+  const auto part2{aoc::timed("part2", [&] { return find_part2(rules, updates); })};
 
   std::println("{} {}", part1, part2);
 
@@ -10,101 +10,87 @@ using Vec2 = ndvec::vec2<int>;
 enum class Tile : char {
   obstacle = '#',
   ground = '.',
+  outside = ' ',
 };
 
-using Grid = std::unordered_map<Vec2, Tile>;
-using Visited = std::unordered_map<Vec2, std::unordered_set<Vec2>>;
+using Grid = aoc::Grid2<Tile>;
+// bit i is set if the guard was at the position facing directions[i]
+using Visited = aoc::Grid2<unsigned char>;
 
-auto find_part2(const Grid& grid, Vec2 init_pos, const Visited& visited) {
-  std::unordered_set<Vec2> new_obstacles;
-  for (const auto& [start_pos, facings] : visited) {
-    Vec2 obstacle{start_pos};
-    if (obstacle != init_pos and grid.contains(obstacle)) {
-      Grid grid2{grid};
-      grid2[obstacle] = Tile::obstacle;
-      Visited seen;
-      for (Vec2 guard{init_pos}, facing(0, -1);;) {
-        if (seen.contains(guard) and seen.at(guard).contains(facing)) {
-          new_obstacles.insert(obstacle);
-          break;
-        }
-        seen[guard].insert(facing);
-        Vec2 next_pos{guard + facing};
-        if (not grid2.contains(next_pos)) {
-          break;
-        }
-        if (grid2.at(next_pos) == Tile::obstacle) {
-          facing.rotate_right();
-        } else {
-          guard = next_pos;
-        }
-      }
+const std::array directions{Vec2(0, -1), Vec2(1, 0), Vec2(0, 1), Vec2(-1, 0)};
+
+// True if the guard ends up in a loop, false if the guard leaves the grid
+bool walk(const Grid& grid, Vec2 guard, Visited& visited) {
+  for (auto dir{0UZ};;) {
+    const auto facing_bit{static_cast<unsigned char>(1U << dir)};
+    if (visited[guard] & facing_bit) {
+      return true;
+    }
+    visited[guard] |= facing_bit;
+    const Vec2 next_pos{guard + directions[dir]};
+    switch (grid[next_pos]) {
+      case Tile::outside:
+        return false;
+      case Tile::obstacle:
+        dir = (dir + 1) % directions.size();
+        break;
+      case Tile::ground:
+        guard = next_pos;
+        break;
     }
   }
-  return new_obstacles.size();
 }
 
-auto search(const Grid& grid, const Vec2& start_pos) {
-  Visited visited;
-  for (Vec2 guard{start_pos}, facing(0, -1);;) {
-    visited[guard].insert(facing);
-    Vec2 next_pos{guard + facing};
-
-    if (not grid.contains(next_pos)) {
-      break;
-    }
-
-    if (grid.at(next_pos) != Tile::obstacle) {
-      guard = next_pos;
-      continue;
+auto find_part2(Grid grid, const Vec2& init_pos, const Visited& visited) {
+  int n_new_obstacles{};
+  for (const Vec2& obstacle : grid.positions()) {
+    if (obstacle != init_pos and visited[obstacle]) {
+      grid[obstacle] = Tile::obstacle;
+      Visited seen(grid.width(), grid.height());
+      n_new_obstacles += walk(grid, init_pos, seen);
+      grid[obstacle] = Tile::ground;
     }
-
-    facing.rotate_right();
   }
+  return n_new_obstacles;
+}
 
-  return std::pair{visited.size(), find_part2(grid, start_pos, visited)};
+auto search(const Grid& grid, const Vec2& start_pos) {
+  Visited visited(grid.width(), grid.height());
+  walk(grid, start_pos, visited);
+  const auto part1{ranges::count_if(grid.positions(), [&visited](const Vec2& p) {
+    return visited[p] != 0;
+  })};
+  return std::pair{part1, find_part2(grid, start_pos, visited)};
 }
 
 auto parse_grid(std::string_view path) {
-  Grid g{};
-  size_t width{};
-  Vec2 p;
   std::optional<Vec2> guard_pos;
-
-  for (const std::string& line : aoc::slurp_lines(path)) {
-    for (p.x() = 0; char ch : line) {
-      switch (ch) {
-        case std::to_underlying(Tile::obstacle):
-        case std::to_underlying(Tile::ground):
-          g[p] = {ch};
-          break;
-        case '^':
-          g[p] = Tile::ground;
-          guard_pos = p;
-          break;
-        default:
-          throw std::runtime_error(std::format("unknown tile '{}'", ch));
+  const auto grid{aoc::parse_grid2(
+      aoc::slurp_lines(path),
+      Tile::outside,
+      [&guard_pos](char ch, const Vec2& p) {
+        switch (ch) {
+          case std::to_underlying(Tile::obstacle):
+          case std::to_underlying(Tile::ground):
+            return Tile{ch};
+          case '^':
+            guard_pos = p;
+            return Tile::ground;
+        }
+        throw std::runtime_error(std::format("unknown tile '{}'", ch));
       }
-      p.x() += 1;
-    }
-    if (width == 0) {
-      width = p.x();
-    } else if (width != p.x()) {
-      throw std::runtime_error("every row must be of equal length");
-    }
-    p.y() += 1;
-  }
+  )};
 
   if (not guard_pos) {
     throw std::runtime_error("grid does not contain location of guard ^");
   }
 
-  return std::pair{g, guard_pos.value()};
+  return std::pair{grid, guard_pos.value()};
 }
 
 int main() {
-  const auto [grid, guard]{parse_grid("/dev/stdin")};
-  const auto [part1, part2]{search(grid, guard)};
+  const auto [grid, guard]{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(grid, guard); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
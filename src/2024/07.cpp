@@ -74,8 +74,10 @@ auto search(const auto& equations) {
 }
 
 int main() {
-  const auto equations{aoc::parse_items<Equation>("/dev/stdin")};
-  const auto [part1, part2]{search(equations)};
+  const auto equations{aoc::timed("parse", [] {
+    return aoc::parse_items<Equation>("/dev/stdin");
+  })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return search(equations); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -69,10 +69,10 @@ auto parse_grid(std::string_view path) {
 }
 
 int main() {
-  const Grid grid{parse_grid("/dev/stdin")};
+  const Grid grid{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
 
-  const auto part1{search(grid, false)};
-  const auto part2{search(grid, true)};
+  const auto part1{aoc::timed("part1", [&] { return search(grid, false); })};
+  const auto part2{aoc::timed("part2", [&] { return search(grid, true); })};
 
   std::println("{} {}", part1, part2);
 
@@ -12,35 +12,31 @@ enum class Tile : char {
   corrupt = '#',
 };
 
-struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-};
+// surrounded by corrupted memory
+using Grid = aoc::Grid2<Tile>;
 
 constexpr int map_width{70};
 
 std::optional<int> shortest_path_length(const Grid& grid) {
-  const Vec2 target(map_width, map_width);
-  std::unordered_set<Vec2> visited;
-  for (std::deque q{std::tuple{Vec2(0, 0), 0}}; not q.empty(); q.pop_front()) {
-    auto [pos, n_steps]{q.front()};
-    if (pos == target) {
-      return n_steps;
-    }
-    if (not grid.tiles.contains(pos) or grid.tiles.at(pos) == Tile::corrupt) {
-      continue;
-    }
-    if (auto&& [_, is_new]{visited.insert(pos)}; is_new) {
-      for (Vec2 adj : pos.adjacent()) {
-        q.emplace_back(adj, n_steps + 1);
-      }
-    }
-  }
-  return {};
+  const auto adjacent{grid.adjacent_offsets()};
+  const auto target{grid.index(Vec2(map_width, map_width))};
+  return aoc::shortest_path(
+      grid.buffer_size(),
+      {grid.index(Vec2(0, 0))},
+      [&](const std::size_t i, auto&& relax) {
+        for (const auto offset : adjacent) {
+          if (const auto adj{i + offset}; grid[adj] == Tile::safe) {
+            relax(adj, 1);
+          }
+        }
+      },
+      [target](const std::size_t i) { return i == target; }
+  );
 }
 
 auto find_part2(Grid grid, auto&& bytes) {
   for (Vec2 p : bytes) {
-    grid.tiles[p] = Tile::corrupt;
+    grid.at(p) = Tile::corrupt;
     if (not shortest_path_length(grid)) {
       return std::format("{},{}", p.x(), p.y());
     }
@@ -63,24 +59,21 @@ auto parse_bytes(std::string_view path) {
 }
 
 Grid build_grid(auto&& bytes) {
-  Grid g;
-  for (Vec2 p; p.y() <= map_width; ++p.y()) {
-    for (p.x() = 0; p.x() <= map_width; ++p.x()) {
-      g.tiles[p] = Tile::safe;
-    }
-  }
+  Grid g(map_width + 1, map_width + 1, Tile::safe, Tile::corrupt);
   for (Vec2 p : bytes) {
-    g.tiles[p] = Tile::corrupt;
+    g.at(p) = Tile::corrupt;
   }
   return g;
 }
 
 int main() {
-  const auto bytes{parse_bytes("/dev/stdin")};
+  const auto bytes{aoc::timed("parse", [] { return parse_bytes("/dev/stdin"); })};
 
   const Grid grid{build_grid(bytes | views::take(1024))};
-  const auto part1{shortest_path_length(grid).value()};
-  const auto part2{find_part2(grid, bytes | views::drop(1024))};
+  const auto part1{aoc::timed("part1", [&] { return shortest_path_length(grid).value(); })};
+  const auto part2{aoc::timed("part2", [&] {
+    return find_part2(grid, bytes | views::drop(1024));
+  })};
 
   std::println("{} {}", part1, part2);
 
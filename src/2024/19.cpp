@@ -87,8 +87,10 @@ auto parse_input(std::string_view path) {
 }
 
 int main() {
-  const auto [towels, designs]{parse_input("/dev/stdin")};
-  const auto [part1, part2]{count_possible(towels, designs)};
+  const auto [towels, designs]{aoc::timed("parse", [] { return parse_input("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] {
+    return count_possible(towels, designs);
+  })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -15,25 +15,23 @@ enum class Tile : char {
   track = '.',
 };
 
-struct Grid {
-  std::unordered_map<Vec2, Tile> tiles;
-
-  [[nodiscard]]
-  Tile get(const Vec2& p) const {
-    return tiles.contains(p) ? tiles.at(p) : Tile::wall;
-  }
-};
+// surrounded by walls
+using Grid = aoc::Grid2<Tile>;
 
+// Track positions and their distance from start, in visiting order
 auto find_all_distances(const Grid& grid, Vec2 start, Vec2 end) {
-  std::unordered_map<Vec2, int> dist;
+  std::vector<std::pair<Vec2, int>> track;
+  aoc::Grid2<unsigned char> seen(grid.width(), grid.height(), false, true);
+  seen[start] = true;
   for (std::deque q{std::tuple{start, 0}}; not q.empty(); q.pop_front()) {
     auto [pos, n_steps]{q.front()};
-    dist[pos] = n_steps;
+    track.emplace_back(pos, n_steps);
     if (pos == end) {
-      return dist;
+      return track;
     }
     for (Vec2 adj : pos.adjacent()) {
-      if (grid.get(adj) == Tile::track and not dist.contains(adj)) {
+      if (grid[adj] == Tile::track and not seen[adj]) {
+        seen[adj] = true;
         q.emplace_back(adj, n_steps + 1);
       }
     }
@@ -47,13 +45,12 @@ auto solve(Grid grid, Vec2 start, Vec2 end) {
   int part1{};
   int part2{};
 
-  const auto distances{find_all_distances(grid, start, end)};
-  auto track_nodes{distances | views::keys | ranges::to<std::vector<Vec2>>()};
+  const auto track{find_all_distances(grid, start, end)};
 
-  for (auto [i, p1] : my_std::views::enumerate(track_nodes)) {
-    for (auto p2 : views::drop(track_nodes, i + 1)) {
-      const auto d1{distances.at(p1)};
-      const auto d2{distances.at(p2)};
+  for (auto [i, node1] : my_std::views::enumerate(track)) {
+    for (auto node2 : views::drop(track, i + 1)) {
+      const auto [p1, d1]{node1};
+      const auto [p2, d2]{node2};
       const auto l1{p1.distance(p2)};
       if (std::max(d1, d2) - std::min(d1, d2) - l1 >= 100) {
         part1 += l1 <= 2;
@@ -66,51 +63,31 @@ auto solve(Grid grid, Vec2 start, Vec2 end) {
 }
 
 auto parse_grid(std::string_view path) {
-  Grid grid{};
   Vec2 start, end;
-  {
-    Vec2 p;
-    std::istringstream is{aoc::slurp_file(path)};
-    std::size_t width{};
-
-    for (std::string line; std::getline(is, line) and not line.empty(); p.y() += 1) {
-      if (width == 0UZ) {
-        width = line.size();
-      } else if (width != line.size()) {
-        throw std::runtime_error("every row must be of equal length");
-      }
-
-      for (p.x() = 0; char ch : line) {
+  const auto grid{aoc::parse_grid2(
+      aoc::slurp_lines(path),
+      Tile::wall,
+      [&start, &end](char ch, const Vec2& p) {
         switch (ch) {
-          case 'S': {
+          case 'S':
             start = p;
-            grid.tiles[p] = Tile::track;
-          } break;
-          case 'E': {
+            return Tile::track;
+          case 'E':
             end = p;
-            grid.tiles[p] = Tile::track;
-          } break;
+            return Tile::track;
           case std::to_underlying(Tile::wall):
-          case std::to_underlying(Tile::track): {
-            grid.tiles[p] = {ch};
-          } break;
-          default:
-            throw std::runtime_error(std::format("unknown tile '{}'", ch));
+          case std::to_underlying(Tile::track):
+            return Tile{ch};
         }
-        p.x() += 1;
+        throw std::runtime_error(std::format("unknown tile '{}'", ch));
       }
-    }
-
-    if (p == Vec2()) {
-      throw std::runtime_error("empty input");
-    }
-  }
+  )};
   return std::tuple{grid, start, end};
 }
 
 int main() {
-  const auto [grid, start, end]{parse_grid("/dev/stdin")};
-  const auto [part1, part2]{solve(grid, start, end)};
+  const auto [grid, start, end]{aoc::timed("parse", [] { return parse_grid("/dev/stdin"); })};
+  const auto [part1, part2]{aoc::timed("part1 and part2", [&] { return solve(grid, start, end); })};
   std::println("{} {}", part1, part2);
   return 0;
 }
@@ -0,0 +1,312 @@
+#include "aoc.hpp"
+#include "intcode.hpp"
+#include "std.hpp"
+
+using std::operator""s;
+
+namespace ranges = std::ranges;
+namespace views = std::views;
+
+using intcode::Instruction;
+using intcode::Mode;
+using intcode::Op;
+using Int = intcode::IntCode::Int;
+
+int n_params(Op op) {
+  switch (op) {
+    case Op::add:
+    case Op::multiply:
+    case Op::less:
+    case Op::equal:
+      return 3;
+    case Op::jump_if_nonzero:
+    case Op::jump_if_zero:
+      return 2;
+    case Op::input:
+    case Op::output:
+    case Op::update_rel_base:
+      return 1;
+    case Op::end:
+      return 0;
+  }
+}
+
+struct Decoded {
+  Instruction ins;
+  std::array<Int, 3> params{};
+};
+
+using Program = std::vector<Int>;
+using Decodings = std::map<Int, Decoded>;
+
+std::optional<Decoded> decode_at(const Program& program, const Int addr) {
+  if (addr < 0 or addr >= std::ssize(program)) {
+    return std::nullopt;
+  }
+  const auto ins{intcode::try_decode(program[addr])};
+  if (ins.op == Op{} or addr + n_params(ins.op) >= std::ssize(program)) {
+    return std::nullopt;
+  }
+  Decoded d{ins};
+  for (int i{}; i < n_params(ins.op); ++i) {
+    d.params[i] = program[addr + 1 + i];
+  }
+  return d;
+}
+
+// Jump that is always taken, such as the jump of a function call
+bool is_unconditional_jump(const Decoded& d) {
+  const auto [op, mode1, mode2, mode3]{d.ins};
+  const auto cond{d.params[0]};
+  return mode1 == Mode::immediate
+         and ((op == Op::jump_if_nonzero and cond != 0) or (op == Op::jump_if_zero and cond == 0));
+}
+
+// Jump that is never taken
+bool is_dead_jump(const Decoded& d) {
+  const auto [op, mode1, mode2, mode3]{d.ins};
+  const auto cond{d.params[0]};
+  return mode1 == Mode::immediate
+         and ((op == Op::jump_if_nonzero and cond == 0) or (op == Op::jump_if_zero and cond != 0));
+}
+
+// Recursive traversal from address 0 that follows fallthrough and jumps to immediate targets.
+// Other immediate operands are mostly constants and variable addresses, so they are not followed,
+// except for constants computed by add or multiply from immediates that point just past an
+// unconditional jump. Those are return addresses stored before a function call jumps away.
+Decodings decode_reachable(const Program& program) {
+  Decodings decoded;
+  std::set<Int> stored_constants;
+  for (std::vector<Int> todo{0}; not todo.empty();) {
+    while (not todo.empty()) {
+      const auto addr{todo.back()};
+      todo.pop_back();
+      if (decoded.contains(addr)) {
+        continue;
+      }
+      const auto d{decode_at(program, addr)};
+      if (not d) {
+        continue;
+      }
+      decoded[addr] = d.value();
+      const auto [op, mode1, mode2, mode3]{d->ins};
+      const auto [p1, p2, p3]{d->params};
+      const auto next{addr + 1 + n_params(op)};
+      switch (op) {
+        case Op::add:
+        case Op::multiply:
+          if (mode1 == Mode::immediate and mode2 == Mode::immediate) {
+            stored_constants.insert(op == Op::add ? p1 + p2 : p1 * p2);
+          }
+          todo.push_back(next);
+          break;
+        case Op::jump_if_nonzero:
+        case Op::jump_if_zero:
+          if (mode2 == Mode::immediate and not is_dead_jump(d.value())) {
+            todo.push_back(p2);
+          }
+          if (not is_unconditional_jump(d.value())) {
+            todo.push_back(next);
+          }
+          break;
+        case Op::end:
+          break;
+        default:
+          todo.push_back(next);
+      }
+    }
+    for (const auto& [addr, d] : decoded) {
+      const auto next{addr + 1 + n_params(d.ins.op)};
+      if (is_unconditional_jump(d) and stored_constants.contains(next)
+          and not decoded.contains(next)) {
+        todo.push_back(next);
+      }
+    }
+  }
+  return decoded;
+}
+
+std::string fmt_read(const Int param, const Mode mode) {
+  switch (mode) {
+    case Mode::immediate:
+      return std::format("{}L", param);
+    case Mode::address:
+      return std::format("rd({})", param);
+    case Mode::relative_address:
+      return std::format("rd(rb + {})", param);
+  }
+}
+
+// Store value and leave native code if an instruction was overwritten
+std::string fmt_write(
+    const Int param,
+    const Mode mode,
+    const std::string& value,
+    const Int next_ip,
+    const std::vector<bool>& is_code
+) {
+  const auto fallback{std::format("if (not ic.native_code_valid) {{ ip = {}; break; }}", next_ip)};
+  switch (mode) {
+    case Mode::immediate:
+      throw std::runtime_error("cannot store in immediate mode");
+    case Mode::address: {
+      if (0 <= param and param < std::ssize(is_code) and is_code[param]) {
+        return std::format("wr({}, {}); {}", param, value, fallback);
+      }
+      return std::format("ic.store({}, {}, Mode::address);", param, value);
+    }
+    case Mode::relative_address:
+      return std::format("wr(rb + {}, {}); {}", param, value, fallback);
+  }
+}
+
+std::string intcode_instruction_as_cpp(
+    const Int addr,
+    const Decoded& d,
+    const std::vector<bool>& is_code
+) {
+  const auto [op, mode1, mode2, mode3]{d.ins};
+  const auto [p1, p2, p3]{d.params};
+  const auto next{addr + 1 + n_params(op)};
+  switch (op) {
+    case Op::add:
+      return fmt_write(
+          p3,
+          mode3,
+          std::format("{} + {}", fmt_read(p1, mode1), fmt_read(p2, mode2)),
+          next,
+          is_code
+      );
+    case Op::multiply:
+      return fmt_write(
+          p3,
+          mode3,
+          std::format("{} * {}", fmt_read(p1, mode1), fmt_read(p2, mode2)),
+          next,
+          is_code
+      );
+    case Op::less:
+      return fmt_write(
+          p3,
+          mode3,
+          std::format("Int{{{} < {}}}", fmt_read(p1, mode1), fmt_read(p2, mode2)),
+          next,
+          is_code
+      );
+    case Op::equal:
+      return fmt_write(
+          p3,
+          mode3,
+          std::format("Int{{{} == {}}}", fmt_read(p1, mode1), fmt_read(p2, mode2)),
+          next,
+          is_code
+      );
+    case Op::input:
+      return std::format(
+          "if (ic.input.empty()) {{ ip = {}; return intcode::Status::needs_input; }} {}",
+          addr,
+          fmt_write(p1, mode1, "ic.pop_input()", next, is_code)
+      );
+    case Op::output:
+      return std::format("ic.output.push_back({});", fmt_read(p1, mode1));
+    case Op::jump_if_nonzero:
+      return std::format(
+          "if ({} != 0) {{ ip = {}; continue; }}",
+          fmt_read(p1, mode1),
+          fmt_read(p2, mode2)
+      );
+    case Op::jump_if_zero:
+      return std::format(
+          "if ({} == 0) {{ ip = {}; continue; }}",
+          fmt_read(p1, mode1),
+          fmt_read(p2, mode2)
+      );
+    case Op::update_rel_base:
+      return std::format("rb += {};", fmt_read(p1, mode1));
+    case Op::end:
+      return "ip = std::numeric_limits<Int>::min(); return intcode::Status::halted;"s;
+  }
+}
+
+void generate_code(std::ostream& os, const Program& program) {
+  const auto decoded{decode_reachable(program)};
+
+  std::vector<bool> is_code(program.size());
+  for (const auto& [addr, d] : decoded) {
+    for (int i{}; i <= n_params(d.ins.op); ++i) {
+      is_code[addr + i] = true;
+    }
+  }
+
+  std::vector lines{
+      "intcode::Status run_native(intcode::IntCode& ic) {"s,
+      "using Int = intcode::IntCode::Int;"s,
+      "using intcode::Mode;"s,
+      std::format("static constexpr std::array<bool, {}> is_code{{", is_code.size()),
+  };
+  for (auto i{0UZ}; i < is_code.size(); i += 32) {
+    std::string line;
+    for (auto j{i}; j < std::min(is_code.size(), i + 32); ++j) {
+      line += is_code[j] ? "1," : "0,";
+    }
+    lines.push_back(line);
+  }
+  ranges::copy(
+      std::vector{
+          "};"s,
+          "auto& ip{ic.instruction_pointer()};"s,
+          "[[maybe_unused]] auto& rb{ic.relative_base()};"s,
+          "[[maybe_unused]] const auto rd{[&ic](Int i) { return ic.load(i, Mode::address); }};"s,
+          "[[maybe_unused]] const auto wr{[&ic](Int i, Int v) {"s,
+          "ic.store(i, v, Mode::address);"s,
+          "if (0 <= i and i < std::ssize(is_code) and is_code[i]) {"s,
+          "ic.native_code_valid = false;"s,
+          "}"s,
+          "}};"s,
+          "while (ic.native_code_valid and not ic.is_done()) {"s,
+          "switch (ip) {"s,
+      },
+      std::back_inserter(lines)
+  );
+
+  for (auto it{decoded.begin()}; it != decoded.end(); ++it) {
+    const auto& [addr, d]{*it};
+    const auto next_addr{addr + 1 + n_params(d.ins.op)};
+    std::string tail;
+    if (d.ins.op != Op::end) {
+      const auto next{std::next(it)};
+      if (next != decoded.end() and next->first == next_addr) {
+        tail = " [[fallthrough]];";
+      } else {
+        tail = std::format(" ip = {}; continue;", next_addr);
+      }
+    }
+    lines.push_back(
+        std::format("case {}: {{ {} }}{}", addr, intcode_instruction_as_cpp(addr, d, is_code), tail)
+    );
+  }
+
+  ranges::copy(
+      std::vector{
+          "default: { return ic.run_until_blocked(); }"s,
+          "}"s,
+          "if (not ic.native_code_valid) { break; }"s,
+          "}"s,
+          "return ic.run_until_blocked();"s,
+          "}"s,
+      },
+      std::back_inserter(lines)
+  );
+
+  ranges::copy(lines, std::ostream_iterator<std::string>(os, "\n"));
+}
+
+int main() {
+  const auto program{intcode::parse_program(aoc::slurp_file("/dev/stdin"))};
+
+  std::cout << "/* src/tools/intcode2cpp GENERATED CODE BEGIN */\n";
+  generate_code(std::cout, program);
+  std::cout << "/* src/tools/intcode2cpp GENERATED CODE END */\n";
+
+  return 0;
+}
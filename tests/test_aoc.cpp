@@ -0,0 +1,526 @@
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "aoc.hpp"
+
+void test_bucket_queue() {
+  std::mt19937 rng{7};
+
+  for (std::size_t key_span : {1UZ, 4UZ, 16UZ}) {
+    aoc::BucketQueue<int> q(key_span);
+    std::multiset<std::pair<std::size_t, int>> expect;
+    auto min_key{0UZ};
+    for (int value{}; value < 2000; ++value) {
+      if (expect.empty() or rng() % 3 != 0) {
+        // mostly keys close to the smallest key, sometimes far past the span of the ring
+        const auto offset{rng() % 8 == 0 ? rng() % 1000 : rng() % 5};
+        const auto item{std::pair{min_key + offset, value}};
+        q.push(item.first, item.second);
+        expect.insert(item);
+      } else {
+        const auto item{q.pop()};
+        const auto smallest{expect.begin()->first};
+        if (item.first != smallest) {
+          throw std::runtime_error(
+              std::format("bucket queue popped key {} before key {}", item.first, smallest)
+          );
+        }
+        if (const auto it{expect.find(item)}; it != expect.end()) {
+          expect.erase(it);
+        } else {
+          throw std::runtime_error(std::format("bucket queue popped unknown item {}", item));
+        }
+        min_key = item.first;
+      }
+      if (q.size() != expect.size()) {
+        throw std::runtime_error(
+            std::format("bucket queue size mismatch: {} != {}", expect.size(), q.size())
+        );
+      }
+    }
+    for (; not expect.empty(); expect.erase(expect.begin())) {
+      if (const auto item{q.pop()}; item.first != expect.begin()->first) {
+        throw std::runtime_error("bucket queue drained out of order");
+      }
+    }
+    if (not q.empty()) {
+      throw std::runtime_error("bucket queue is not empty after popping every item");
+    }
+  }
+
+  aoc::BucketQueue<int> q;
+  q.push(5, 0);
+  q.pop();
+  try {
+    q.push(4, 0);
+    throw std::runtime_error("bucket queue accepted a key below the last popped key");
+  } catch (const std::invalid_argument&) {
+  }
+}
+
+void test_shortest_path() {
+  std::mt19937 rng{11};
+
+  for (int graph{}; graph < 200; ++graph) {
+    const auto n{2UZ + rng() % 30};
+    struct Edge {
+      std::size_t src;
+      std::size_t dst;
+      int weight;
+    };
+    std::vector<Edge> edges;
+    for (auto i{rng() % (3 * n)}; i > 0; --i) {
+      // many zero weight edges
+      edges.push_back({rng() % n, rng() % n, static_cast<int>(rng() % 4)});
+    }
+    std::vector<std::vector<std::pair<std::size_t, int>>> adjacent(n);
+    for (const auto& e : edges) {
+      adjacent[e.src].emplace_back(e.dst, e.weight);
+    }
+
+    // Bellman-Ford from the sources
+    const std::vector<std::size_t> sources{rng() % n, rng() % n};
+    const auto unreached{std::numeric_limits<int>::max()};
+    std::vector<int> dist(n, unreached);
+    for (const auto s : sources) {
+      dist[s] = 0;
+    }
+    for (auto round{0UZ}; round < n; ++round) {
+      for (const auto& e : edges) {
+        if (dist[e.src] != unreached) {
+          dist[e.dst] = std::min(dist[e.dst], dist[e.src] + e.weight);
+        }
+      }
+    }
+
+    const auto goal{rng() % n};
+    const auto result{aoc::shortest_path(
+        n,
+        sources,
+        [&](const std::size_t s, auto&& relax) {
+          for (const auto& [t, w] : adjacent[s]) {
+            relax(t, w);
+          }
+        },
+        [&](const std::size_t s) { return s == goal; }
+    )};
+    const auto expect{
+        dist[goal] == unreached ? std::optional<int>{} : std::optional<int>{dist[goal]}
+    };
+    if (result != expect) {
+      throw std::runtime_error(std::format(
+          "shortest path to {} of {} states: {} != {}",
+          goal,
+          n,
+          expect.value_or(-1),
+          result.value_or(-1)
+      ));
+    }
+  }
+}
+
+void test_scan() {
+  using namespace std::string_view_literals;
+
+  const auto check{[](const auto& result, const auto& expect, std::string_view what) {
+    if (result != expect) {
+      throw std::runtime_error(std::format("scan {}: unexpected result", what));
+    }
+  }};
+  using Ints = std::optional<std::tuple<int, int>>;
+
+  check(aoc::scan<"x={} y={}">("x=-3 y=+4"), Ints{{-3, 4}}, "signs");
+  check(aoc::scan<"x={} y={}">("x=3  y=4\n"), Ints{{3, 4}}, "whitespace");
+  check(aoc::scan<"x={} y={}">("x=3y=4"), Ints{{3, 4}}, "whitespace matching nothing");
+  check(aoc::scan<"x={} y={}">("x=3 z=4"), Ints{}, "literal mismatch");
+  check(aoc::scan<"x={} y={}">("x=3 y="), Ints{}, "missing field");
+  check(aoc::scan<"x={} y={}">("x=3 y=4 z"), Ints{}, "trailing input");
+  check(aoc::scan<"x={} y={}">("x=+-3 y=4"), Ints{}, "two signs");
+  check(aoc::scan<"x={} y={}">("x=- 3 y=4"), Ints{}, "detached sign");
+  check(aoc::scan<"{}", unsigned>("-3"), std::optional<std::tuple<unsigned>>{}, "unsigned");
+  check(
+      aoc::scan<"{} -> {}: {}", std::string_view, char, long>("abc -> z: 12345678901"),
+      std::optional{std::tuple{"abc"sv, 'z', 12345678901L}},
+      "strings and chars"
+  );
+
+  auto s{"1,2;3,4;x"sv};
+  check(aoc::scan_prefix<"{},{};">(s), Ints{{1, 2}}, "first prefix");
+  check(aoc::scan_prefix<"{},{};">(s), Ints{{3, 4}}, "second prefix");
+  check(aoc::scan_prefix<"{},{};">(s), Ints{}, "unmatched prefix");
+  check(s, "x"sv, "rest after unmatched prefix");
+}
+
+void test_block_list() {
+  std::mt19937 rng{13};
+
+  const auto check{[](const aoc::BlockList& list, const std::vector<std::size_t>& expect) {
+    if (list.size() != expect.size()) {
+      throw std::runtime_error(
+          std::format("block list size mismatch: {} != {}", expect.size(), list.size())
+      );
+    }
+    for (auto pos{0UZ}; pos < expect.size(); ++pos) {
+      if (list.at(pos) != expect[pos] or list.position(expect[pos]) != pos) {
+        throw std::runtime_error(std::format("block list mismatch at position {}", pos));
+      }
+    }
+  }};
+
+  // starts empty, grows past several rebuilds and shrinks back to empty, so that blocks run
+  // empty and the block size changes in both directions
+  const auto capacity{3000UZ};
+  aoc::BlockList list(capacity);
+  std::vector<std::size_t> expect;
+  std::vector<std::size_t> unused(capacity);
+  std::iota(unused.begin(), unused.end(), 0UZ);
+  std::ranges::shuffle(unused, rng);
+  check(list, expect);
+
+  for (int phase{}; phase < 4; ++phase) {
+    const bool growing{phase % 2 == 0};
+    for (int step{}; step < 4000; ++step) {
+      const auto op{rng() % 4};
+      if ((growing and op < 2 and not unused.empty()) or expect.empty()) {
+        // inserts at the front, the back and right before the first id of a block
+        const auto pos{op == 0 ? expect.size() : rng() % (expect.size() + 1)};
+        const auto id{unused.back()};
+        unused.pop_back();
+        list.insert(pos, id);
+        expect.insert(expect.begin() + static_cast<std::ptrdiff_t>(pos), id);
+      } else if (op < 3 and growing) {
+        const auto id{expect[rng() % expect.size()]};
+        const auto pos{rng() % expect.size()};
+        list.move(id, pos);
+        std::erase(expect, id);
+        expect.insert(expect.begin() + static_cast<std::ptrdiff_t>(pos), id);
+      } else {
+        const auto pos{op == 3 ? expect.size() - 1 : rng() % expect.size()};
+        const auto id{list.erase(pos)};
+        if (id != expect[pos]) {
+          throw std::runtime_error(std::format("block list erased {} at {}", id, pos));
+        }
+        expect.erase(expect.begin() + static_cast<std::ptrdiff_t>(pos));
+        unused.push_back(id);
+      }
+      if (step % 97 == 0) {
+        check(list, expect);
+      }
+    }
+    check(list, expect);
+    while (not growing and not expect.empty()) {
+      const auto id{list.erase(0)};
+      if (id != expect.front()) {
+        throw std::runtime_error("block list erased the wrong id from the front");
+      }
+      expect.erase(expect.begin());
+      unused.push_back(id);
+      check(list, expect);
+    }
+  }
+
+  // many inserts at one position overflow the same block and force rebuilds
+  for (auto id{0UZ}; id < 1000; ++id) {
+    list.insert(list.size() / 2, id);
+    expect.insert(expect.begin() + static_cast<std::ptrdiff_t>(expect.size() / 2), id);
+  }
+  check(list, expect);
+
+  const aoc::BlockList initial(8, std::array{3UZ, 1UZ, 4UZ});
+  check(initial, {3, 1, 4});
+  for (const auto& bad : std::vector<std::function<void()>>{
+           [&] { (void)initial.at(3); },
+           [&] { (void)initial.position(0); },
+           [&] { (void)initial.position(8); },
+           [&] { list.insert(list.size() + 1, 0); },
+           [&] { list.insert(0, capacity); },
+           [&] { list.erase(list.size()); },
+           [] { aoc::BlockList(2, std::array{2UZ}); },
+       }) {
+    try {
+      bad();
+      throw std::runtime_error("block list accepted an out of range argument");
+    } catch (const std::out_of_range&) {
+    }
+  }
+}
+
+void test_grid2() {
+  using Vec2 = aoc::Grid2<int>::Vec2;
+
+  for (const int pad : {1, 2}) {
+    const int width{67};
+    const int height{3};
+    aoc::Grid2<int> grid(width, height, 7, -1, pad);
+    if (grid.buffer_size() != static_cast<std::size_t>((width + 2 * pad) * (height + 2 * pad))) {
+      throw std::runtime_error(std::format("grid buffer size {}", grid.buffer_size()));
+    }
+    for (int y{-pad}; y < height + pad; ++y) {
+      for (int x{-pad}; x < width + pad; ++x) {
+        const Vec2 p(x, y);
+        const bool inside{0 <= x and x < width and 0 <= y and y < height};
+        if (grid.contains(p) != inside) {
+          throw std::runtime_error(std::format("grid contains ({}, {}) is {}", x, y, not inside));
+        }
+        if (grid[p] != (inside ? 7 : -1)) {
+          throw std::runtime_error(std::format("grid cell ({}, {}) is {}", x, y, grid[p]));
+        }
+        if (grid.position(grid.index(p)) != p) {
+          throw std::runtime_error(std::format("grid position of index of ({}, {})", x, y));
+        }
+        if (not inside) {
+          try {
+            (void)grid.at(p);
+            throw std::runtime_error(std::format("grid at accepted ({}, {})", x, y));
+          } catch (const std::out_of_range&) {
+          }
+        }
+      }
+    }
+    for (auto i{0UZ}; i < grid.buffer_size(); ++i) {
+      if (grid.index(grid.position(i)) != i) {
+        throw std::runtime_error(std::format("grid index of position of {}", i));
+      }
+    }
+
+    // the offsets reach the border from every edge cell
+    const std::array directions{Vec2(0, -1), Vec2(1, 0), Vec2(0, 1), Vec2(-1, 0)};
+    for (const auto& p : grid.positions()) {
+      for (auto d{0UZ}; d < directions.size(); ++d) {
+        const auto i{static_cast<std::ptrdiff_t>(grid.index(p)) + grid.adjacent_offsets()[d]};
+        if (grid.position(static_cast<std::size_t>(i)) != p + directions[d]) {
+          throw std::runtime_error(std::format("grid offset {} from ({}, {})", d, p.x(), p.y()));
+        }
+      }
+    }
+
+    grid.at(Vec2(width - 1, height - 1)) = 3;
+    if (grid.find(3) != Vec2(width - 1, height - 1) or grid.find(-1) or grid.find(4)) {
+      throw std::runtime_error("grid find");
+    }
+  }
+
+  const std::vector<std::string> lines{"ab", "cd", "ef"};
+  const auto chars{aoc::parse_grid2(lines, '#')};
+  if (chars.width() != 2 or chars.height() != 3 or chars[Vec2(1, 2)] != 'f'
+      or chars[Vec2(-1, 0)] != '#' or chars[Vec2(2, 3)] != '#' or chars.find('d') != Vec2(1, 1)) {
+    throw std::runtime_error("parse_grid2 of chars");
+  }
+  std::vector<Vec2> seen;
+  const auto mapped{aoc::parse_grid2(lines, -1, [&seen](char ch, const Vec2& p) {
+    seen.push_back(p);
+    return (ch - 'a') * 100 + p.x() * 10 + p.y();
+  })};
+  if (not std::ranges::equal(seen, mapped.positions())) {
+    throw std::runtime_error("parse_grid2 mapper positions are not in row-major order");
+  }
+  for (const auto& p : mapped.positions()) {
+    if (mapped[p] != (lines[p.y()][p.x()] - 'a') * 100 + p.x() * 10 + p.y()) {
+      throw std::runtime_error(std::format("parse_grid2 mapped ({}, {})", p.x(), p.y()));
+    }
+  }
+  for (const auto& bad : {std::vector<std::string>{}, std::vector<std::string>{"ab", "c"}}) {
+    try {
+      (void)aoc::parse_grid2(bad);
+      throw std::runtime_error("parse_grid2 accepted an empty or ragged grid");
+    } catch (const std::runtime_error& e) {
+      if (std::string_view(e.what()).starts_with("parse_grid2")) {
+        throw;
+      }
+    }
+  }
+}
+
+// Path of a new temporary file with the given content
+std::string write_temp_file(std::string_view name, std::string_view content) {
+  const auto path{std::filesystem::temp_directory_path() / std::format("test_aoc_{}", name)};
+  std::ofstream(path, std::ios::binary) << content;
+  return path.string();
+}
+
+bool throws(auto&& fn) {
+  try {
+    fn();
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+void test_input_view() {
+  using Lines = std::vector<std::string_view>;
+
+  // regular files are memory-mapped, except empty ones which cannot be
+  for (const auto& [content, expect] : std::vector<std::pair<std::string, Lines>>{
+           {"a b\n\nc\n", {"a b", "", "c"}},
+           {"a b\n\nc", {"a b", "", "c"}},
+           {"\n", {""}},
+           {"x", {"x"}},
+           {"", {}},
+       }) {
+    const auto path{write_temp_file("input", content)};
+    aoc::InputView input(path);
+    if (input.data() != content or input.lines() != expect) {
+      throw std::runtime_error(std::format("InputView of file '{}'", content));
+    }
+    const aoc::InputView moved(std::move(input));
+    if (moved.data() != content or not input.data().empty()) {
+      throw std::runtime_error(std::format("moved InputView of file '{}'", content));
+    }
+    std::filesystem::remove(path);
+  }
+
+  // a pipe cannot be mapped and is read in chunks, this one more than fits in the pipe buffer
+  std::string content;
+  for (int i{}; content.size() < 200'000; ++i) {
+    content += std::format("line {}\n", i);
+  }
+  std::array<int, 2> fds{};
+  if (::pipe(fds.data()) != 0) {
+    throw std::runtime_error("cannot create a pipe");
+  }
+  std::jthread writer{[&content, fd = fds[1]] {
+    for (std::string_view rest{content}; not rest.empty();) {
+      const auto n{::write(fd, rest.data(), rest.size())};
+      if (n <= 0) {
+        break;
+      }
+      rest.remove_prefix(static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+  }};
+  aoc::InputView input(std::format("/dev/fd/{}", fds[0]));
+  writer.join();
+  ::close(fds[0]);
+  const auto lines{input.lines()};
+  const auto n_lines{static_cast<std::size_t>(std::ranges::count(content, '\n'))};
+  if (input.data() != content or lines.size() != n_lines
+      or lines.back() != std::format("line {}", n_lines - 1)) {
+    throw std::runtime_error("InputView of a pipe");
+  }
+  const aoc::InputView moved(std::move(input));
+  if (moved.data() != content) {
+    throw std::runtime_error("moved InputView of a pipe");
+  }
+
+  if (not throws([] { aoc::InputView("/nonexistent/input"); })) {
+    throw std::runtime_error("InputView of a missing file");
+  }
+}
+
+void test_split_and_fields() {
+  using Parts = std::vector<std::string_view>;
+  if (aoc::split("a,,b,", ',') != Parts{"a", "", "b", ""} or aoc::split("", ',') != Parts{""}) {
+    throw std::runtime_error("split");
+  }
+  if (aoc::fields(" a  b\tc\n") != Parts{"a", "b", "c"} or not aoc::fields(" \n ").empty()) {
+    throw std::runtime_error("fields");
+  }
+  if (aoc::fields("1, 2,,3\n", ',') != Parts{"1", "2", "3"}) {
+    throw std::runtime_error("fields with a separator");
+  }
+}
+
+void test_scan_int() {
+  using namespace std::string_view_literals;
+
+  auto s{"x=-12, y=+7 z- 5-3"sv};
+  for (const int expect : {-12, 7, 5, -3}) {
+    if (aoc::scan_int<int>(s) != expect) {
+      throw std::runtime_error(std::format("scan_int did not find {}", expect));
+    }
+    if (expect == -12 and s != ", y=+7 z- 5-3") {
+      throw std::runtime_error("scan_int did not advance past the integer");
+    }
+  }
+  if (aoc::scan_int<int>(s) or not s.empty()) {
+    throw std::runtime_error("scan_int after the last integer");
+  }
+
+  // a minus sign is not part of an unsigned integer
+  if (aoc::scan_ints<unsigned>("-12, 5-3") != std::vector<unsigned>{12, 5, 3}) {
+    throw std::runtime_error("scan_ints of unsigned integers");
+  }
+  if (aoc::scan_ints("-12, 5-3 a-b -") != std::vector{-12, 5, -3}) {
+    throw std::runtime_error("scan_ints of signed integers");
+  }
+  const std::vector longs{9'000'000'000L, -9'000'000'000L};
+  if (aoc::scan_ints<long>("9000000000 -9000000000") != longs) {
+    throw std::runtime_error("scan_ints of long integers");
+  }
+  if (not throws([] { (void)aoc::scan_ints<std::int8_t>("1 300"); })) {
+    throw std::runtime_error("scan_int of an integer out of range");
+  }
+
+  if (aoc::to_int<int>("+5") != 5 or aoc::to_int<int>("-5") != -5) {
+    throw std::runtime_error("to_int");
+  }
+  for (const auto bad : {"+-5"sv, "5x"sv, ""sv, "-"sv, "256"sv}) {
+    if (not throws([bad] { (void)aoc::to_int<std::uint8_t>(bad); })) {
+      throw std::runtime_error(std::format("to_int of '{}'", bad));
+    }
+  }
+}
+
+void test_parse_items() {
+  const auto path{write_temp_file("items", "1 -2,3\n+4\n")};
+  if (aoc::parse_items<int>(path, ',') != std::vector{1, -2, 3, 4}) {
+    throw std::runtime_error("parse_items of integers");
+  }
+  if (aoc::parse_items<std::string>(path) != std::vector<std::string>{"1", "-2,3", "+4"}) {
+    throw std::runtime_error("parse_items of strings");
+  }
+  if (aoc::parse_items<char>(path, ',') != std::vector{'1', '-', '2', '3', '+', '4'}) {
+    throw std::runtime_error("parse_items of chars");
+  }
+  // every field must be an integer, there is no stopping at the first one that is not
+  if (not throws([&path] { (void)aoc::parse_items<int>(path); })) {
+    throw std::runtime_error("parse_items of integers accepted '-2,3'");
+  }
+  std::filesystem::remove(path);
+
+  // a malformed or out of range last token, or a negative unsigned, is an error and not the end
+  for (const auto content : {"1 2 3-", "1 2 99999999999", "1 -2"}) {
+    const auto bad{write_temp_file("bad", content)};
+    if (not throws([&bad] { (void)aoc::parse_items<unsigned>(bad); })) {
+      throw std::runtime_error(std::format("parse_items of unsigned integers '{}'", content));
+    }
+    std::filesystem::remove(bad);
+  }
+
+  const auto empty{write_temp_file("empty", " \n")};
+  if (not throws([&empty] { (void)aoc::parse_items<int>(empty); })) {
+    throw std::runtime_error("parse_items of an empty input");
+  }
+  std::filesystem::remove(empty);
+}
+
+int main() {
+  test_bucket_queue();
+  test_shortest_path();
+  test_scan();
+  test_block_list();
+  test_grid2();
+  test_input_view();
+  test_split_and_fields();
+  test_scan_int();
+  test_parse_items();
+  return 0;
+}
@@ -0,0 +1,219 @@
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <format>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "cellular.hpp"
+
+using cellular::Board;
+using cellular::Word;
+
+template <std::size_t N>
+Board<N> random_board(const typename Board<N>::Index& shape, std::mt19937& rng) {
+  Board<N> board(shape);
+  for (auto r{0UZ}; r < board.n_rows(); ++r) {
+    auto p{board.row_position(r)};
+    for (p[0] = 0; p[0] < shape[0]; ++p[0]) {
+      board.set(p, rng() % 3 == 0);
+    }
+  }
+  return board;
+}
+
+// Live cells in the Moore neighbourhood of p, including p, counted one cell at a time
+template <std::size_t N>
+unsigned naive_count(const Board<N>& board, const typename Board<N>::Index& p) {
+  unsigned n{};
+  std::array<int, N> d{};
+  d.fill(-1);
+  for (;;) {
+    auto q{p};
+    for (auto i{0UZ}; i < N; ++i) {
+      q[i] += d[i];
+    }
+    n += board.test(q) ? 1 : 0;
+    auto i{0UZ};
+    for (; i < N and d[i] == 1; ++i) {
+      d[i] = -1;
+    }
+    if (i == N) {
+      return n;
+    }
+    d[i] += 1;
+  }
+}
+
+// Calls f(p) for every cell of the board
+template <std::size_t N>
+void for_each_cell(const Board<N>& board, auto&& f) {
+  for (auto r{0UZ}; r < board.n_rows(); ++r) {
+    auto p{board.row_position(r)};
+    for (p[0] = 0; p[0] < board.shape()[0]; ++p[0]) {
+      f(p);
+    }
+  }
+}
+
+template <std::size_t N>
+void check_unused_bits_clear(const Board<N>& board, auto what) {
+  for (auto r{0UZ}; r < board.n_rows(); ++r) {
+    if (board.row(r).back() & ~board.last_word_mask()) {
+      throw std::runtime_error(std::format("{}: bits past the end of row {} are set", what, r));
+    }
+  }
+}
+
+void test_counts() {
+  std::mt19937_64 rng{3};
+  cellular::Counts<4> counts;
+  std::array<unsigned, cellular::word_bits> expect{};
+  for (int round{}; round < 15; ++round) {
+    const auto w{rng() & rng()};
+    counts.add(w);
+    for (auto x{0UZ}; x < cellular::word_bits; ++x) {
+      expect[x] += (w >> x) & 1U;
+    }
+  }
+
+  // adding counters of a narrower width carries into the upper planes
+  cellular::Counts<2> small;
+  small.planes = {rng(), rng()};
+  counts.add(small);
+  for (auto x{0UZ}; x < cellular::word_bits; ++x) {
+    expect[x] += ((small.planes[0] >> x) & 1U) + 2 * ((small.planes[1] >> x) & 1U);
+  }
+
+  for (unsigned n{}; n < 20; ++n) {
+    for (auto x{0UZ}; x < cellular::word_bits; ++x) {
+      const auto equals{((counts.equals(n) >> x) & 1U) != 0};
+      const auto at_least{((counts.at_least(n) >> x) & 1U) != 0};
+      if (equals != (expect[x] == n) or at_least != (expect[x] >= n)) {
+        throw std::runtime_error(std::format("counter of cell {} is {}, not {}", x, expect[x], n));
+      }
+    }
+  }
+}
+
+template <std::size_t N>
+void check_moore_counts(const Board<N>& board) {
+  const auto totals{cellular::moore_counts(board)};
+  for_each_cell(board, [&](const auto& p) {
+    const auto x{static_cast<std::size_t>(p[0])};
+    const auto& total{totals[board.row_index(p) * board.row_words() + x / cellular::word_bits]};
+    const auto n{naive_count(board, p)};
+    if (((total.equals(n) >> (x % cellular::word_bits)) & 1U) == 0) {
+      throw std::runtime_error(std::format("moore count at x {} row {}", x, board.row_index(p)));
+    }
+  });
+}
+
+void test_moore_counts() {
+  std::mt19937 rng{7};
+  // rows of one, two and three words, the last with unused bits
+  check_moore_counts(random_board<1>({150}, rng));
+  check_moore_counts(random_board<2>({64, 5}, rng));
+  check_moore_counts(random_board<2>({130, 9}, rng));
+  check_moore_counts(random_board<3>({70, 4, 3}, rng));
+  check_moore_counts(random_board<4>({65, 3, 3, 2}, rng));
+}
+
+void test_step() {
+  std::mt19937 rng{11};
+  auto board{random_board<2>({150, 12}, rng)};
+  for (int generation{}; generation < 6; ++generation) {
+    const auto next{cellular::step(board, cellular::conway<cellular::moore_bits(2)>)};
+    for_each_cell(board, [&](const auto& p) {
+      const auto n{naive_count(board, p)};
+      if (next.test(p) != (n == 3 or (board.test(p) and n == 4))) {
+        throw std::runtime_error(std::format("step {} at {} {}", generation, p[0], p[1]));
+      }
+    });
+    check_unused_bits_clear(next, "step");
+    board = next;
+  }
+
+  // a rule that sets every cell must not set the bits past the end of a row
+  const auto full{cellular::step(board, [](Word, const auto&) { return ~Word{}; })};
+  if (full.count() != 150 * 12) {
+    throw std::runtime_error(std::format("step set {} cells", full.count()));
+  }
+}
+
+void test_grown() {
+  std::mt19937 rng{13};
+  const auto board{random_board<2>({100, 6}, rng)};
+  for (const int margin : {0, 1, 2, 30, 64, 70}) {
+    for (const bool fill : {false, true}) {
+      const auto out{board.grown(margin, fill)};
+      if (out.shape() != Board<2>::Index{100 + 2 * margin, 6 + 2 * margin}) {
+        throw std::runtime_error(std::format("grown by {} has the wrong shape", margin));
+      }
+      for_each_cell(out, [&](const auto& p) {
+        const Board<2>::Index q{p[0] - margin, p[1] - margin};
+        const auto expect{board.contains(q) ? board.test(q) : fill};
+        if (out.test(p) != expect) {
+          throw std::runtime_error(
+              std::format("grown by {} fill {} at {} {}", margin, fill, p[0], p[1])
+          );
+        }
+      });
+      check_unused_bits_clear(out, std::format("grown by {}", margin));
+    }
+  }
+}
+
+void test_step_window() {
+  std::mt19937 rng{17};
+  for (const bool flips : {false, true}) {
+    std::bitset<512> table;
+    for (auto i{0UZ}; i < table.size(); ++i) {
+      table[i] = rng() % 2 == 1;
+    }
+    // with table[0] set and table[511] clear the infinite background flips every step
+    table[0] = flips;
+    table[511] = not flips;
+
+    auto board{random_board<2>({90, 7}, rng)};
+    bool background{false};
+    for (int generation{}; generation < 4; ++generation) {
+      const auto next{
+          cellular::step_window(board, [&table](unsigned i) { return table[i]; }, background)
+      };
+      const auto cell{[&](const int x, const int y) {
+        return board.contains({x, y}) ? board.test({x, y}) : background;
+      }};
+      for_each_cell(next, [&](const auto& p) {
+        // p is one cell up and left of the same cell on the board
+        unsigned i{};
+        for (int dy{-1}; dy <= 1; ++dy) {
+          for (int dx{-1}; dx <= 1; ++dx) {
+            i = i << 1 | (cell(p[0] - 1 + dx, p[1] - 1 + dy) ? 1U : 0U);
+          }
+        }
+        if (next.test(p) != table[i]) {
+          throw std::runtime_error(std::format(
+              "step_window {} with flips {} at {} {}", generation, flips, p[0], p[1]
+          ));
+        }
+      });
+      check_unused_bits_clear(next, "step_window");
+      board = next;
+      background = table[background ? 511 : 0];
+    }
+    if (background != false) {
+      throw std::runtime_error("background after an even number of steps");
+    }
+  }
+}
+
+int main() {
+  test_counts();
+  test_moore_counts();
+  test_step();
+  test_grown();
+  test_step_window();
+  return 0;
+}
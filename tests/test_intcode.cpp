@@ -0,0 +1,197 @@
+#include <deque>
+#include <format>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "intcode.hpp"
+
+using Int = intcode::IntCode::Int;
+
+// All outputs of program after it has run to the end with the given inputs
+std::vector<Int> run_program(const std::vector<Int>& program, const std::vector<Int>& inputs = {}) {
+  intcode::IntCode ic(program);
+  ic.input.append_range(inputs);
+  ic.run_to_end();
+  std::vector<Int> outputs;
+  while (const auto out{ic.pop_output()}) {
+    outputs.push_back(out.value());
+  }
+  return outputs;
+}
+
+void check_outputs(const std::vector<Int>& result, const std::vector<Int>& expect, auto what) {
+  if (result != expect) {
+    throw std::runtime_error(std::format("{}: outputs {} != {}", what, expect, result));
+  }
+}
+
+void test_memory() {
+  constexpr Int paged_limit{1L << 22};
+
+  intcode::Memory m(std::vector<Int>{1, 2, 3});
+  const std::vector<Int> addresses{
+      0, 511, 512, paged_limit - 1, paged_limit, paged_limit + 1, -1, -paged_limit, 1L << 40
+  };
+  for (const auto i : addresses) {
+    m.store(i, i ^ 0x5a);
+  }
+  for (const auto i : addresses) {
+    if (m.load(i) != (i ^ 0x5a)) {
+      throw std::runtime_error(std::format("memory load at {} is {}", i, m.load(i)));
+    }
+  }
+  for (const auto i : {1L, 513L, paged_limit - 2, paged_limit + 2, -2L}) {
+    if (m.load(i) != (i == 1 ? 2 : 0)) {
+      throw std::runtime_error(std::format("memory load of unwritten address {}", i));
+    }
+  }
+
+  // copies share pages until written
+  auto copy{m};
+  copy.store(0, 99);
+  copy.store(paged_limit, 98);
+  if (m.load(0) != (0 ^ 0x5a) or m.load(paged_limit) != (paged_limit ^ 0x5a) or copy.load(0) != 99
+      or copy.load(paged_limit) != 98 or copy.load(511) != m.load(511)) {
+    throw std::runtime_error("memory copy is not independent");
+  }
+
+  // the decoded instruction follows every store
+  copy.store(5, 1002);
+  if (const auto ins{copy.instruction(5)};
+      ins.op != intcode::Op::multiply or ins.mode1 != intcode::Mode::address
+      or ins.mode2 != intcode::Mode::immediate) {
+    throw std::runtime_error("memory instruction was not decoded on store");
+  }
+  copy.store(5, 99);
+  if (copy.instruction(5).op != intcode::Op::end or copy.instruction(0).op != intcode::Op::end) {
+    throw std::runtime_error("memory instruction was not decoded again after a store");
+  }
+  copy.store(5, 42);
+  try {
+    (void)copy.instruction(5);
+    throw std::runtime_error("memory decoded an invalid instruction");
+  } catch (const std::runtime_error& e) {
+    if (std::string_view(e.what()).starts_with("memory")) {
+      throw;
+    }
+  }
+}
+
+void test_self_modifying() {
+  // 104 is stored over the 99 at address 4, which then outputs 42 instead of halting
+  check_outputs(run_program({1101, 100, 4, 4, 99, 42, 99}), {42}, "store over next instruction");
+
+  // a loop that overwrites an instruction it has already executed, the counter is at 20
+  const std::vector<Int> loop{
+      4, 20,             // 0: output counter
+      1001, 20, 1, 20,   // 2: counter += 1
+      1008, 20, 3, 21,   // 6: flag = counter == 3
+      1006, 21, 0,       // 10: if flag == 0 jump to 0
+      1101, 99, 0, 0,    // 13: store 99 at 0
+      1105, 1, 0,        // 17: jump to 0, which now halts
+      0, 0,
+  };
+  check_outputs(run_program(loop), {0, 1, 2}, "overwrite an executed instruction");
+}
+
+void test_addresses() {
+  // relative base -10, store 5 + 6 at -10 and output it, then 7 + 11 at 1 << 22
+  check_outputs(
+      run_program({109, -10, 21101, 5, 6, 0, 204, 0, 109, 4194314, 21101, 7, 11, 0, 204, 0, 99}),
+      {11, 18},
+      "negative and far addresses"
+  );
+  // address mode store to a negative address
+  check_outputs(run_program({1101, 3, 4, -7, 4, -7, 99}), {7}, "negative address");
+}
+
+void test_fork_and_snapshot() {
+  // read a value to address 100, output it, repeat
+  const std::vector<Int> echo{3, 100, 4, 100, 1105, 1, 0};
+
+  intcode::IntCode a(echo);
+  a.input.push_back(1);
+  if (a.run_until_blocked() != intcode::Status::needs_input) {
+    throw std::runtime_error("echo should wait for its second input");
+  }
+  auto b{a.fork()};
+  b.input.push_back(2);
+  b.run_until_blocked();
+  a.input.push_back(3);
+  a.run_until_blocked();
+  if (a.load(100, intcode::Mode::address) != 3 or b.load(100, intcode::Mode::address) != 2) {
+    throw std::runtime_error("fork shares memory writes");
+  }
+  if (a.output.size() != 2 or a.output.back() != 3 or b.output.size() != 2
+      or b.output.back() != 2) {
+    throw std::runtime_error("fork shares output");
+  }
+
+  const auto s{a.snapshot()};
+  a.input.push_back(4);
+  a.run_until_blocked();
+  a.store(0, 99, intcode::Mode::address);
+  a.restore(s);
+  a.input.push_back(5);
+  a.run_until_blocked();
+  if (a.load(100, intcode::Mode::address) != 5 or a.output.size() != 3 or a.output.back() != 5) {
+    throw std::runtime_error("restore did not bring back the snapshot");
+  }
+}
+
+void test_run_until_blocked() {
+  // read one value and output it twice
+  intcode::IntCode ic(std::vector<Int>{3, 50, 4, 50, 4, 50, 99});
+  if (ic.run_until_blocked() != intcode::Status::needs_input or not ic.output.empty()) {
+    throw std::runtime_error("run_until_blocked without input");
+  }
+  ic.input.push_back(7);
+  if (ic.run_until_blocked(1) != intcode::Status::output_ready or ic.output.size() != 1) {
+    throw std::runtime_error("run_until_blocked with max_output 1");
+  }
+  if (ic.run_until_blocked(1) != intcode::Status::output_ready or ic.output.size() != 1) {
+    throw std::runtime_error("run_until_blocked with a full output queue should not step");
+  }
+  if (ic.run_until_blocked() != intcode::Status::halted or not ic.is_done()
+      or ic.output.size() != 2 or ic.output.front() != 7) {
+    throw std::runtime_error("run_until_blocked to halt");
+  }
+  if (ic.run_until_blocked() != intcode::Status::halted) {
+    throw std::runtime_error("run_until_blocked after halt");
+  }
+}
+
+void test_queue() {
+  std::mt19937 rng{5};
+  intcode::Queue<Int> q;
+  std::deque<Int> expect;
+  for (Int value{}; value < 5000; ++value) {
+    // pops keep the head moving, so the ring wraps around and grows with a non-zero head
+    if (expect.empty() or rng() % 5 < 3) {
+      q.push_back(value);
+      expect.push_back(value);
+    } else {
+      q.pop_front();
+      expect.pop_front();
+    }
+    if (q.size() != expect.size()
+        or (not expect.empty() and (q.front() != expect.front() or q.back() != expect.back()))) {
+      throw std::runtime_error(std::format("queue differs after pushing value {}", value));
+    }
+  }
+  q.clear();
+  if (not q.empty() or q.size() != 0) {
+    throw std::runtime_error("queue is not empty after clear");
+  }
+}
+
+int main() {
+  test_memory();
+  test_self_modifying();
+  test_addresses();
+  test_fork_and_snapshot();
+  test_run_until_blocked();
+  test_queue();
+  return 0;
+}
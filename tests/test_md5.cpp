@@ -0,0 +1,137 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "md5.hpp"
+
+void test_sum() {
+  // test suite of RFC 1321
+  const std::array<std::pair<std::string, std::string>, 7> suite{{
+      {"", "d41d8cd98f00b204e9800998ecf8427e"},
+      {"a", "0cc175b9c0f1b6a831c399e269772661"},
+      {"abc", "900150983cd24fb0d6963f7d28e17f72"},
+      {"message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+      {"abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b"},
+      {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+       "d174ab98d277d9f5a5611c2c9f419d9f"},
+      {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+       "57edf4a22be3c955ac49da2e2107b67a"},
+  }};
+  for (const auto& [msg, expect] : suite) {
+    if (const auto digest{md5::hexdigest(md5::sum(msg))}; digest != expect) {
+      throw std::runtime_error(std::format("md5 of '{}' is {}, not {}", msg, digest, expect));
+    }
+  }
+}
+
+// Messages of length first, first + 1, ..., all different in every position
+template <std::size_t N>
+std::array<std::string, N> messages(const std::size_t first) {
+  std::array<std::string, N> msgs;
+  for (auto lane{0UZ}; lane < N; ++lane) {
+    for (auto i{0UZ}; i < first + lane; ++i) {
+      msgs[lane].push_back(static_cast<char>('!' + (7 * i + 13 * lane) % 90));
+    }
+  }
+  return msgs;
+}
+
+template <std::size_t N>
+void check_sum_batch() {
+  // lengths around the padding boundaries at 56 and 64 bytes, and messages of several chunks
+  for (const auto first : {0UZ, 50UZ, 55UZ, 60UZ, 119UZ, 200UZ}) {
+    const auto msgs{messages<N>(first)};
+    const auto states{md5::sum_batch(msgs)};
+    const auto chunks{md5::sum32bit_batch(msgs)};
+    for (auto lane{0UZ}; lane < N; ++lane) {
+      if (states[lane] != md5::sum(msgs[lane]) or chunks[lane] != md5::sum32bit(msgs[lane])) {
+        throw std::runtime_error(std::format(
+            "sum_batch of {} lanes differs in lane {} of length {}", N, lane, msgs[lane].size()
+        ));
+      }
+    }
+  }
+}
+
+void test_sum_batch() {
+  check_sum_batch<1>();
+  check_sum_batch<4>();
+  check_sum_batch<md5::lanes>();
+  check_sum_batch<16>();
+}
+
+template <std::size_t N>
+void check_prefix_hasher(const std::string& prefix, const uint64_t first) {
+  const md5::PrefixHasher hasher(prefix);
+  const auto states{hasher.sum_batch<N>(first)};
+  const auto chunks{hasher.sum32bit_batch<N>(first)};
+  for (auto lane{0UZ}; lane < N; ++lane) {
+    const auto n{first + lane};
+    const auto msg{prefix + std::to_string(n)};
+    const auto expect{md5::sum(msg)};
+    if (hasher.sum(n) != expect or hasher.sum32bit(n) != md5::sum32bit(msg)) {
+      throw std::runtime_error(std::format("PrefixHasher of '{}'", msg));
+    }
+    if (states[lane] != expect or chunks[lane] != md5::sum32bit(msg)) {
+      throw std::runtime_error(std::format("PrefixHasher batch of {} lanes of '{}'", N, msg));
+    }
+  }
+}
+
+void test_prefix_hasher() {
+  for (auto size : {0UZ, 8UZ, 49UZ, 64UZ, 70UZ, 113UZ, 130UZ}) {
+    std::string prefix;
+    for (auto i{0UZ}; i < size; ++i) {
+      prefix.push_back(static_cast<char>('a' + i % 26));
+    }
+    // 999'990 + lane has 6 digits in the first ten lanes and 7 after, so with 49 and 113 byte
+    // prefixes the nonce crosses the 56 byte boundary and needs a second chunk in some lanes only
+    for (const uint64_t first : {0UL, 999'990UL, 18'446'744'073'709'551'600UL}) {
+      check_prefix_hasher<1>(prefix, first);
+      check_prefix_hasher<md5::lanes>(prefix, first);
+      check_prefix_hasher<16>(prefix, first);
+    }
+  }
+}
+
+void test_stretch() {
+  constexpr std::size_t n{8};
+  const auto msgs{messages<n>(3)};
+  const auto states{md5::sum_batch(msgs)};
+
+  // hexdigest_chunk of every lane is the padded hexdigest of that lane
+  const auto words{md5::hexdigest_chunk(md5::detail::to_lanes(states))};
+  const auto inputs{md5::detail::from_lanes<n>(words)};
+  for (auto lane{0UZ}; lane < n; ++lane) {
+    if (inputs[lane] != md5::padded_chunk(md5::hexdigest(states[lane]), 0)) {
+      throw std::runtime_error(std::format("hexdigest_chunk of lane {}", lane));
+    }
+  }
+
+  for (const int rounds : {0, 1, 2, 17}) {
+    const auto stretched{md5::stretch_batch(states, rounds)};
+    for (auto lane{0UZ}; lane < n; ++lane) {
+      auto expect{states[lane]};
+      for (int r{}; r < rounds; ++r) {
+        expect = md5::sum(md5::hexdigest(expect));
+      }
+      auto scalar{states[lane]};
+      md5::stretch(scalar, rounds);
+      if (stretched[lane] != expect or scalar != expect) {
+        throw std::runtime_error(std::format("stretch of lane {} by {} rounds", lane, rounds));
+      }
+    }
+  }
+}
+
+int main() {
+  test_sum();
+  test_sum_batch();
+  test_prefix_hasher();
+  test_stretch();
+  return 0;
+}
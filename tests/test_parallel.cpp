@@ -0,0 +1,173 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <format>
+#include <optional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <stop_token>
+#include <string_view>
+#include <vector>
+
+#include "parallel.hpp"
+
+// Calls fn, which must throw a std::runtime_error with the given message
+void check_throws(auto&& fn, std::string_view message, auto what) {
+  try {
+    fn();
+  } catch (const std::runtime_error& e) {
+    if (e.what() == message) {
+      return;
+    }
+    throw;
+  }
+  throw std::runtime_error(std::format("{}: no exception", what));
+}
+
+void test_parallel_for(parallel::ThreadPool& pool) {
+  for (const auto [begin, end, block_size] : std::vector<std::array<std::size_t, 3>>{
+           {0, 1000, 1}, {5, 1000, 7}, {3, 4, 100}, {10, 10, 3}, {20, 10, 3}
+       }) {
+    std::vector<std::atomic<int>> calls(1000);
+    std::atomic<std::size_t> n_blocks{};
+    pool.parallel_for(begin, end, block_size, [&](std::size_t first, std::size_t last) {
+      if (last - first > block_size or (last < end and last - first != block_size)) {
+        throw std::runtime_error(std::format("block [{}, {})", first, last));
+      }
+      for (auto i{first}; i < last; ++i) {
+        calls[i] += 1;
+      }
+      n_blocks += 1;
+    });
+    for (auto i{0UZ}; i < calls.size(); ++i) {
+      if (calls[i] != (begin <= i and i < end ? 1 : 0)) {
+        throw std::runtime_error(std::format("parallel_for called {} {} times", i, +calls[i]));
+      }
+    }
+    if (end > begin and n_blocks != (end - begin + block_size - 1) / block_size) {
+      throw std::runtime_error(std::format("parallel_for ran {} blocks", +n_blocks));
+    }
+  }
+
+  // nothing runs after a stop request
+  std::stop_source stop;
+  stop.request_stop();
+  std::atomic<int> n_calls{};
+  pool.parallel_for(0, 100, 1, [&](auto, auto) { n_calls += 1; }, stop.get_token());
+  if (n_calls != 0) {
+    throw std::runtime_error("parallel_for ran blocks after a stop request");
+  }
+
+  // the first exception is rethrown, and every block that starts after it is skipped,
+  // so each thread, including the waiting one, calls fn at most once
+  check_throws(
+      [&] {
+        pool.parallel_for(0, 10'000, 1, [&](auto, auto) {
+          n_calls += 1;
+          throw std::runtime_error("block failed");
+        });
+      },
+      "block failed",
+      "parallel_for"
+  );
+  if (n_calls > static_cast<int>(pool.size()) + 1) {
+    throw std::runtime_error(std::format("parallel_for ran {} blocks after throwing", +n_calls));
+  }
+}
+
+void test_parallel_find_first(parallel::ThreadPool& pool) {
+  // matches in many blocks, the lowest one must win whatever block finishes first
+  std::mt19937 rng{19};
+  for (int round{}; round < 50; ++round) {
+    std::set<std::size_t> matches;
+    for (auto n{rng() % 20}; n > 0; --n) {
+      matches.insert(rng() % 5000);
+    }
+    const auto begin{static_cast<std::size_t>(rng() % 100)};
+    const auto block_size{1 + rng() % 64};
+    std::optional<std::size_t> expect;
+    if (const auto it{matches.lower_bound(begin)}; it != matches.end()) {
+      expect = *it;
+    }
+    const auto result{pool.parallel_find_first(
+        begin, [&](std::size_t i) { return matches.contains(i); }, 5000, block_size
+    )};
+    if (result != expect) {
+      throw std::runtime_error(std::format("parallel_find_first in round {}", round));
+    }
+  }
+
+  // without an end the search runs until the first match
+  if (pool.parallel_find_first(1, [](std::size_t i) { return i % 12'345 == 0; }) != 12'345) {
+    throw std::runtime_error("parallel_find_first without end");
+  }
+  if (pool.parallel_find_first(7, [](auto) { return true; }, 7)) {
+    throw std::runtime_error("parallel_find_first of an empty range");
+  }
+
+  // an exception ends the search even though nothing would ever match
+  check_throws(
+      [&] {
+        (void)pool.parallel_find_first(0, [](std::size_t i) {
+          if (i == 50'000) {
+            throw std::runtime_error("search failed");
+          }
+          return false;
+        });
+      },
+      "search failed",
+      "parallel_find_first"
+  );
+}
+
+void test_parallel_find_first_n(parallel::ThreadPool& pool) {
+  const auto multiple_of_7{[](std::size_t i) { return i % 7 == 0; }};
+  const auto hits{pool.parallel_find_first_n(10, 100'000, 500, multiple_of_7, 16)};
+  if (hits.size() != 500 or hits.front() != 14 or hits.back() != 14 + 7 * 499) {
+    throw std::runtime_error("parallel_find_first_n of multiples of 7");
+  }
+  for (auto i{1UZ}; i < hits.size(); ++i) {
+    if (hits[i] != hits[i - 1] + 7) {
+      throw std::runtime_error(std::format("parallel_find_first_n hit {} is {}", i, hits[i]));
+    }
+  }
+
+  // fewer matches than requested
+  const auto few{pool.parallel_find_first_n(0, 50, 100, multiple_of_7, 3)};
+  if (few != std::vector<std::size_t>{0, 7, 14, 21, 28, 35, 42, 49}) {
+    throw std::runtime_error("parallel_find_first_n with fewer matches");
+  }
+  if (not pool.parallel_find_first_n(0, 50, 0, multiple_of_7).empty()) {
+    throw std::runtime_error("parallel_find_first_n of zero matches");
+  }
+
+  check_throws(
+      [&] {
+        (void)pool.parallel_find_first_n(0, 1UZ << 40, 1, [](std::size_t i) {
+          if (i == 50'000) {
+            throw std::runtime_error("predicate failed");
+          }
+          return false;
+        });
+      },
+      "predicate failed",
+      "parallel_find_first_n"
+  );
+}
+
+int main() {
+  for (const unsigned n_threads : {1U, 4U}) {
+    parallel::ThreadPool pool(n_threads);
+    if (pool.size() != n_threads) {
+      throw std::runtime_error("thread pool size");
+    }
+    test_parallel_for(pool);
+    test_parallel_find_first(pool);
+    test_parallel_find_first_n(pool);
+  }
+  if (&parallel::thread_pool() != &parallel::thread_pool() or parallel::thread_pool().size() == 0) {
+    throw std::runtime_error("shared thread pool");
+  }
+  return 0;
+}
@@ -0,0 +1,204 @@
+#include <format>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "regvm.hpp"
+
+using regvm::Int;
+
+// Registers after executing the parsed instructions one at a time, without compiling or fusing
+std::vector<Int> run_reference(regvm::Program program, std::vector<Int> r) {
+  auto& is{program.instructions};
+  const auto value{[&r](const regvm::Arg& arg) {
+    return arg.is_register ? r[arg.value] : arg.value;
+  }};
+  for (Int ip{}; 0 <= ip and ip < std::ssize(is); ++ip) {
+    if (program.ip_register) {
+      r[*program.ip_register] = ip;
+    }
+    const auto [op, a, b, c]{is[ip]};
+    if (regvm::detail::writes_c(op) and not c.is_register) {
+      continue;
+    }
+    switch (op) {
+      case regvm::Op::set:
+        r[c.value] = value(a);
+        break;
+      case regvm::Op::add:
+        r[c.value] = value(a) + value(b);
+        break;
+      case regvm::Op::sub:
+        r[c.value] = value(a) - value(b);
+        break;
+      case regvm::Op::mul:
+        r[c.value] = value(a) * value(b);
+        break;
+      case regvm::Op::mod:
+        r[c.value] = value(a) % value(b);
+        break;
+      case regvm::Op::band:
+        r[c.value] = value(a) & value(b);
+        break;
+      case regvm::Op::bor:
+        r[c.value] = value(a) | value(b);
+        break;
+      case regvm::Op::eq:
+        r[c.value] = Int{value(a) == value(b)};
+        break;
+      case regvm::Op::gt:
+        r[c.value] = Int{value(a) > value(b)};
+        break;
+      case regvm::Op::jnz:
+        ip += value(a) != 0 ? value(b) - 1 : 0;
+        break;
+      case regvm::Op::jgz:
+        ip += value(a) > 0 ? value(b) - 1 : 0;
+        break;
+      case regvm::Op::tgl:
+        if (const auto target{ip + value(a)}; 0 <= target and target < std::ssize(is)) {
+          regvm::toggle(is[target]);
+        }
+        break;
+      default:
+        throw std::runtime_error("reference interpreter does not support the instruction");
+    }
+    if (program.ip_register) {
+      ip = r[*program.ip_register];
+    }
+  }
+  return r;
+}
+
+// Registers after running the compiled and fused program
+std::vector<Int> run_machine(const regvm::Program& program, const std::vector<Int>& r) {
+  regvm::Machine m(program);
+  std::ranges::copy(r, m.registers().begin());
+  if (m.run() != regvm::Status::halted) {
+    throw std::runtime_error("machine did not halt");
+  }
+  return {m.registers().begin(), m.registers().end()};
+}
+
+void check_registers(const regvm::Program& program, const std::vector<Int>& r, auto what) {
+  const auto expect{run_reference(program, r)};
+  const auto result{run_machine(program, r)};
+  if (result != expect) {
+    throw std::runtime_error(std::format("{}: registers {} != {}", what, expect, result));
+  }
+}
+
+void test_assembunny() {
+  // add_clear in both orders of inc and dec
+  const auto inc_dec{regvm::parse_assembunny("cpy 5 b\ninc a\ndec b\njnz b -2\n")};
+  check_registers(inc_dec, {3, 0, 0, 0}, "inc dec");
+  const auto dec_inc{regvm::parse_assembunny("cpy 5 b\ndec b\ninc a\njnz b -2\n")};
+  check_registers(dec_inc, {3, 0, 0, 0}, "dec inc");
+
+  // mul_add, with immediate and register sources
+  const std::string mul{"cpy 7 b\ncpy 6 d\ncpy b c\ninc a\ndec c\njnz c -2\ndec d\njnz d -5\n"};
+  check_registers(regvm::parse_assembunny(mul), {1, 0, 0, 0}, "mul_add");
+  const std::string mul_imm{"cpy 6 d\ncpy 7 c\ninc a\ndec c\njnz c -2\ndec d\njnz d -5\n"};
+  check_registers(regvm::parse_assembunny(mul_imm), {1, 0, 0, 0}, "mul_add immediate");
+  if (run_machine(regvm::parse_assembunny(mul), {1, 0, 0, 0}).front() != 43) {
+    throw std::runtime_error("mul_add result");
+  }
+
+  // tgl rewrites an instruction inside the fused loop on every pass, inc a and dec a in turn
+  const std::string toggled{
+      "cpy 4 b\ncpy 5 d\ncpy b c\ninc a\ndec c\njnz c -2\ndec d\njnz d -5\n"
+      "tgl -5\ncpy 2 d\ndec b\njnz b -9\n"
+  };
+  check_registers(regvm::parse_assembunny(toggled), {0, 0, 0, 0}, "tgl in a fused loop");
+  if (run_machine(regvm::parse_assembunny(toggled), {0, 0, 0, 0}).front() != 16) {
+    throw std::runtime_error("tgl in a fused loop result");
+  }
+
+  // the example of 2016/23, a toggled cpy with an immediate destination is skipped
+  check_registers(
+      regvm::parse_assembunny("cpy 2 a\ntgl a\ntgl a\ntgl a\ncpy 1 a\ndec a\ndec a\n"),
+      {0, 0, 0, 0},
+      "tgl example"
+  );
+}
+
+void test_elf() {
+  // sum of the divisors of n, the shape of 2018/19 with ip 5, s 0, i 1, j 2, t 3 and n 4.
+  // Unless j starts at 1 only the inner loop is fused, and its guard fails while j is 0.
+  const auto divisor_sum{[](const Int n, const Int first_j = 1) {
+    return regvm::parse_elf(std::format(
+        "#ip 5\n"
+        "seti {} 0 4\nseti 1 0 1\n"
+        "seti {} 0 2\nmulr 1 2 3\neqrr 3 4 3\naddr 3 5 5\naddi 5 1 5\naddr 1 0 0\n"
+        "addi 2 1 2\ngtrr 2 4 3\naddr 5 3 5\nseti 2 0 5\n"
+        "addi 1 1 1\ngtrr 1 4 3\naddr 3 5 5\nseti 1 0 5\n"
+        "mulr 5 5 5\n",
+        n,
+        first_j
+    ));
+  }};
+  for (const Int n : {1L, 2L, 12L, 36L, 97L, 360L}) {
+    check_registers(divisor_sum(n), std::vector<Int>(6), std::format("divisor sum of {}", n));
+    check_registers(divisor_sum(n, 0), std::vector<Int>(6), std::format("divisor check {}", n));
+  }
+  // far too slow without fusion
+  if (const auto r{run_machine(divisor_sum(10'551'236), std::vector<Int>(6))}; r[0] != 18'514'860) {
+    throw std::runtime_error(std::format("divisor sum of 10551236 is {}", r[0]));
+  }
+
+  // q = x / 256 by counting, the shape of 2018/21 with ip 3, q 1, x 2 and t 4
+  const auto div_loop{[](const Int x) {
+    return regvm::parse_elf(std::format(
+        "#ip 3\n"
+        "seti {} 0 2\nseti 0 0 1\n"
+        "addi 1 1 4\nmuli 4 256 4\ngtrr 4 2 4\naddr 4 3 3\naddi 3 1 3\nseti 9 0 3\n"
+        "addi 1 1 1\nseti 1 0 3\n"
+        "setr 1 0 5\n",
+        x
+    ));
+  }};
+  for (const Int x : {0L, 255L, 256L, 257L, 65'535L, 100'000L}) {
+    check_registers(div_loop(x), std::vector<Int>(6), std::format("div loop of {}", x));
+  }
+}
+
+void test_find_cycle() {
+  // 0, 1, ..., 10, then back to 4
+  const auto cycle{regvm::find_cycle(0, [](const int x) { return x == 10 ? 4 : x + 1; })};
+  if (cycle.start != 4 or cycle.length != 7) {
+    throw std::runtime_error(std::format("cycle at {} of length {}", cycle.start, cycle.length));
+  }
+  if (const auto c{regvm::find_cycle(5, std::identity{})}; c.start != 0 or c.length != 1) {
+    throw std::runtime_error("fixed point cycle");
+  }
+
+  // random functions on a small domain against the first repeated state
+  std::mt19937 rng{17};
+  for (int round{}; round < 200; ++round) {
+    std::vector<int> f(1 + rng() % 300);
+    for (auto& y : f) {
+      y = static_cast<int>(rng() % f.size());
+    }
+    const auto next{[&f](const int x) { return f[x]; }};
+    std::map<int, std::size_t> seen;
+    auto x{0};
+    for (auto i{0UZ}; seen.emplace(x, i).second; ++i) {
+      x = next(x);
+    }
+    const auto expect{regvm::Cycle{seen[x], seen.size() - seen[x]}};
+    if (const auto c{regvm::find_cycle(0, next)};
+        c.start != expect.start or c.length != expect.length) {
+      throw std::runtime_error(std::format("cycle of random function {}", round));
+    }
+  }
+}
+
+int main() {
+  test_assembunny();
+  test_elf();
+  test_find_cycle();
+  return 0;
+}